@@ -0,0 +1,226 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+/** @file
+ *  @brief Measures the insert and lookup throughput of the qtools
+ *  dictionaries, with and without their lookup index.
+ *
+ *  The keys are the identifiers found in the given source files, in the
+ *  order they appear, which resembles how doxygen's symbol tables are used.
+ *  In the build pass each identifier is looked up and inserted if it was
+ *  not found yet, in the lookup pass each identifier is looked up again.
+ *  Rates are given in million identifiers per second.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <string.h>
+
+#include <qdict.h>
+#include <qintdict.h>
+#include <qfile.h>
+#include <qdir.h>
+#include <qfileinfo.h>
+#include <qstrlist.h>
+#include <qdatetime.h>
+
+static void readIdentifiers(const QCString &fileName,QStrList &ids)
+{
+  QFile f(fileName);
+  if (!f.open(IO_ReadOnly)) return;
+  QByteArray data = f.readAll();
+  const char *p = data.data(), *e = p+data.size();
+  while (p<e)
+  {
+    if (isalpha((uchar)*p) || *p=='_')
+    {
+      const char *s = p;
+      while (p<e && (isalnum((uchar)*p) || *p=='_' || *p==':')) p++;
+      QCString id((int)(p-s)+1); // the file data is not 0-terminated
+      memcpy(id.rawData(),s,p-s);
+      ids.append(id);
+    }
+    else
+    {
+      p++;
+    }
+  }
+}
+
+static void readInput(const char *name,QStrList &ids)
+{
+  QFileInfo fi(name);
+  if (fi.isDir())
+  {
+    QDir dir(name);
+    dir.setFilter(QDir::Files);
+    const QFileInfoList *list = dir.entryInfoList();
+    if (list)
+    {
+      QFileInfoListIterator it(*list);
+      QFileInfo *cfi;
+      for (;(cfi=it.current());++it)
+      {
+        QCString ext = cfi->extension(FALSE).utf8();
+        if (ext=="cpp" || ext=="h" || ext=="l" || ext=="y")
+        {
+          readIdentifiers(cfi->absFilePath().utf8(),ids);
+        }
+      }
+    }
+  }
+  else
+  {
+    readIdentifiers(name,ids);
+  }
+}
+
+/** Result of one benchmark run */
+struct BenchResult
+{
+  double buildRate;  // identifiers per second while filling the dictionary
+  double lookupRate; // identifiers per second when looking them up again
+  uint   count;      // number of distinct keys
+};
+
+static BenchResult benchAscii(const QStrList &ids,int size,int repeat)
+{
+  static int value;
+  BenchResult r;
+  QTime t;
+  int ops=0,buildMs=0,lookupMs=0;
+  QStrListIterator it(ids);
+  const char *id;
+  for (int i=0;i<repeat;i++)
+  {
+    QDict<int> dict(size);
+    // first pass: look up each identifier and insert the new ones
+    t.start();
+    for (it.toFirst();(id=it.current());++it)
+    {
+      if (dict.find(id)==0) dict.insert(id,&value);
+    }
+    buildMs+=t.elapsed();
+    // second pass: look up each identifier again
+    t.start();
+    for (it.toFirst();(id=it.current());++it)
+    {
+      if (dict.find(id)==0) printf("Error: %s not found\n",id);
+    }
+    lookupMs+=t.elapsed();
+    ops+=ids.count();
+    r.count = dict.count();
+  }
+  r.buildRate  = ops*1000.0/QMAX(buildMs,1);
+  r.lookupRate = ops*1000.0/QMAX(lookupMs,1);
+  return r;
+}
+
+static BenchResult benchInt(const QStrList &ids,int size,int repeat)
+{
+  static int value;
+  BenchResult r;
+  QArray<long> keys(ids.count());
+  QStrListIterator it(ids);
+  const char *id;
+  uint n=0;
+  for (it.toFirst();(id=it.current());++it)
+  {
+    long h=0;
+    while (*id) h=h*31+(uchar)*id++;
+    keys[n++]=h&0xffffff;
+  }
+  QTime t;
+  int ops=0,buildMs=0,lookupMs=0;
+  for (int i=0;i<repeat;i++)
+  {
+    QIntDict<int> dict(size);
+    t.start();
+    for (uint j=0;j<n;j++)
+    {
+      if (dict.find(keys[j])==0) dict.insert(keys[j],&value);
+    }
+    buildMs+=t.elapsed();
+    t.start();
+    for (uint j=0;j<n;j++)
+    {
+      if (dict.find(keys[j])==0) printf("Error: %ld not found\n",keys[j]);
+    }
+    lookupMs+=t.elapsed();
+    ops+=n;
+    r.count = dict.count();
+  }
+  r.buildRate  = ops*1000.0/QMAX(buildMs,1);
+  r.lookupRate = ops*1000.0/QMAX(lookupMs,1);
+  return r;
+}
+
+static void report(const char *name,int size,const BenchResult &chained,const BenchResult &indexed)
+{
+  printf("%-9s %6d %8u | %10.2f %10.2f | %10.2f %10.2f | %6.2fx %6.2fx\n",
+      name,size,chained.count,
+      chained.buildRate/1e6,chained.lookupRate/1e6,
+      indexed.buildRate/1e6,indexed.lookupRate/1e6,
+      indexed.buildRate/chained.buildRate,
+      indexed.lookupRate/chained.lookupRate);
+}
+
+int main(int argc,char **argv)
+{
+  if (argc<2)
+  {
+    printf("Usage: %s [-r repeat] file_or_dir...\n"
+           "Use doxygen's src directory as input to measure doxygen's own workload.\n",argv[0]);
+    exit(1);
+  }
+  int repeat=3;
+  QStrList ids;
+  for (int i=1;i<argc;i++)
+  {
+    if (qstrcmp(argv[i],"-r")==0 && i+1<argc)
+    {
+      repeat=atoi(argv[++i]); // not inside QMAX, which evaluates its arguments twice
+      if (repeat<1) repeat=1;
+    }
+    else
+    {
+      readInput(argv[i],ids);
+    }
+  }
+  printf("%u identifiers\n",ids.count());
+  printf("%-9s %6s %8s | %21s | %21s | %14s\n","dict","size","keys",
+         "chained Mops/s","indexed Mops/s","speedup");
+  printf("%-9s %6s %8s | %10s %10s | %10s %10s | %6s  %6s\n","","","",
+         "build","lookup","build","lookup","build","lookup");
+  static const int sizes[] = { 17, 257, 1009, 50177 };
+  for (uint s=0;s<sizeof(sizes)/sizeof(sizes[0]);s++)
+  {
+    QGDict::setIndexEnabled(FALSE);
+    BenchResult chained = benchAscii(ids,sizes[s],repeat);
+    QGDict::setIndexEnabled(TRUE);
+    BenchResult indexed = benchAscii(ids,sizes[s],repeat);
+    report("QDict",sizes[s],chained,indexed);
+  }
+  for (uint s=0;s<sizeof(sizes)/sizeof(sizes[0]);s++)
+  {
+    QGDict::setIndexEnabled(FALSE);
+    BenchResult chained = benchInt(ids,sizes[s],repeat);
+    QGDict::setIndexEnabled(TRUE);
+    BenchResult indexed = benchInt(ids,sizes[s],repeat);
+    report("QIntDict",sizes[s],chained,indexed);
+  }
+  return 0;
+}
@@ -29,6 +29,7 @@
 #include <qfile.h>
 #include <qdir.h>
 #include "doxygen.h"
+#include "symbolmap.h"
 #include "outputgen.h"
 #include "parserintf.h"
 #include "classdef.h"
@@ -146,7 +147,7 @@ static void listSymbol(Definition *d)
 
 static void listSymbols()
 {
-  QDictIterator<DefinitionIntf> sli(*Doxygen::symbolMap);
+  SymbolMap::Iterator sli(*Doxygen::symbolMap);
   DefinitionIntf *di;
   for (sli.toFirst();(di=sli.current());++sli)
   {
@@ -195,7 +195,7 @@ std::string argumentData(Argument *argument) {
 std::string functionSignature(MemberDef* md) {
   std::string signature = sanitizeString(md->name().data());
   if(md->isFunction()){
-    ArgumentList *argList = md->argumentList();
+    const ArgumentList *argList = md->argumentList();
     signature += "(";
     if (argList) {
       ArgumentListIterator iterator(*argList);
@@ -255,7 +255,7 @@ void cModule(ClassDef* cd) {
   }
 }
 
-static bool checkOverrideArg(ArgumentList *argList, MemberDef *md) {
+static bool checkOverrideArg(const ArgumentList *argList, MemberDef *md) {
   ArgumentListIterator iterator(*argList);
   Argument * argument = iterator.toFirst();
 
@@ -278,7 +278,7 @@ void functionInformation(MemberDef* md) {
   std::string temp = "";
   int size = md->getEndBodyLine() - md->getStartBodyLine() + 1;
   printNumberOfLines(size);
-  ArgumentList *argList = md->argumentList();
+  const ArgumentList *argList = md->argumentList();
   if (argList) {
       ArgumentListIterator iterator(*argList);
       Argument * argument = iterator.toFirst();
@@ -0,0 +1,224 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+/** @file
+ *  @brief Measures the throughput and heap allocation rate of QCString.
+ *
+ *  The strings are the identifiers found in the given source files, in the
+ *  order they appear. Each identifier is turned into a QCString, copied,
+ *  and joined with the previous one into a qualified name, like doxygen
+ *  does for scopes and members. Strings of up to SHORT_STR_MAX_LEN
+ *  characters are stored inline, longer ones need a heap block; the
+ *  allocation rate is the number of heap blocks needed per second.
+ *  Rates are given in millions per second.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <string.h>
+
+#include <qcstring.h>
+#include <qfile.h>
+#include <qdir.h>
+#include <qfileinfo.h>
+#include <qstrlist.h>
+#include <qdatetime.h>
+
+//! longest string that fitted inline when QCString used two pointers of space
+static const uint oldShortMaxLen = 2*sizeof(void*)-3;
+
+static void readIdentifiers(const QCString &fileName,QStrList &ids)
+{
+  QFile f(fileName);
+  if (!f.open(IO_ReadOnly)) return;
+  QByteArray data = f.readAll();
+  const char *p = data.data(), *e = p+data.size();
+  while (p<e)
+  {
+    if (isalpha((uchar)*p) || *p=='_')
+    {
+      const char *s = p;
+      while (p<e && (isalnum((uchar)*p) || *p=='_' || *p==':')) p++;
+      QCString id((int)(p-s)+1); // the file data is not 0-terminated
+      memcpy(id.rawData(),s,p-s);
+      ids.append(id);
+    }
+    else
+    {
+      p++;
+    }
+  }
+}
+
+static void readInput(const char *name,QStrList &ids)
+{
+  QFileInfo fi(name);
+  if (fi.isDir())
+  {
+    QDir dir(name);
+    dir.setFilter(QDir::Files);
+    const QFileInfoList *list = dir.entryInfoList();
+    if (list)
+    {
+      QFileInfoListIterator it(*list);
+      QFileInfo *cfi;
+      for (;(cfi=it.current());++it)
+      {
+        QCString ext = cfi->extension(FALSE).utf8();
+        if (ext=="cpp" || ext=="h" || ext=="l" || ext=="y")
+        {
+          readIdentifiers(cfi->absFilePath().utf8(),ids);
+        }
+      }
+    }
+  }
+  else
+  {
+    readIdentifiers(name,ids);
+  }
+}
+
+/** Result of one benchmark */
+struct BenchResult
+{
+  BenchResult() : ops(0), ms(0), heap(0), oldHeap(0) {}
+  uint ops;     // number of strings produced
+  int  ms;      // time spent producing them
+  uint heap;    // number of heap blocks needed
+  uint oldHeap; // number of heap blocks needed with the old inline buffer
+  void count(uint len)
+  {
+    if (len>(uint)SHORT_STR_MAX_LEN) heap++;
+    if (len>oldShortMaxLen) oldHeap++;
+  }
+};
+
+static uint g_sink; // keeps the compiler from removing the work
+
+static BenchResult benchCreate(const QStrList &ids,int repeat)
+{
+  BenchResult r;
+  QStrListIterator it(ids);
+  const char *id;
+  for (it.toFirst();(id=it.current());++it) r.count(qstrlen(id));
+  QTime t;
+  t.start();
+  for (int i=0;i<repeat;i++)
+  {
+    for (it.toFirst();(id=it.current());++it)
+    {
+      QCString s(id);
+      g_sink+=s.length();
+    }
+  }
+  r.ms   = t.elapsed();
+  r.ops  = ids.count();
+  return r;
+}
+
+static BenchResult benchCopy(const QCString *strs,uint n,int repeat)
+{
+  BenchResult r; // copies share long strings, so they never need a heap block
+  QTime t;
+  t.start();
+  for (int i=0;i<repeat;i++)
+  {
+    for (uint j=0;j<n;j++)
+    {
+      QCString s = strs[j];
+      g_sink+=s.length();
+    }
+  }
+  r.ms  = t.elapsed();
+  r.ops = n;
+  return r;
+}
+
+static BenchResult benchConcat(const QCString *strs,uint n,int repeat)
+{
+  BenchResult r;
+  uint j;
+  for (j=1;j<n;j++)
+  {
+    r.count(strs[j-1].length()+2);                    // temporary scope+"::"
+    r.count(strs[j-1].length()+2+strs[j].length());   // the qualified name
+  }
+  QTime t;
+  t.start();
+  for (int i=0;i<repeat;i++)
+  {
+    for (j=1;j<n;j++)
+    {
+      QCString s = strs[j-1]+"::"+strs[j];
+      g_sink+=s.length();
+    }
+  }
+  r.ms  = t.elapsed();
+  r.ops = n-1;
+  return r;
+}
+
+static void report(const char *name,const BenchResult &r,int repeat)
+{
+  double opsPerSec = (double)r.ops*repeat*1000.0/QMAX(r.ms,1);
+  double heapPerOp = r.ops ? (double)r.heap/r.ops : 0.0;
+  double oldPerOp  = r.ops ? (double)r.oldHeap/r.ops : 0.0;
+  printf("%-8s %10.2f | %8.1f%% %8.1f%% | %10.2f %10.2f\n",
+      name,opsPerSec/1e6,
+      100.0*(1.0-heapPerOp),100.0*(1.0-oldPerOp),
+      opsPerSec*heapPerOp/1e6,opsPerSec*oldPerOp/1e6);
+}
+
+int main(int argc,char **argv)
+{
+  if (argc<2)
+  {
+    printf("Usage: %s [-r repeat] file_or_dir...\n"
+           "Use doxygen's src directory as input to measure doxygen's own workload.\n",argv[0]);
+    exit(1);
+  }
+  int repeat=3;
+  QStrList ids;
+  for (int i=1;i<argc;i++)
+  {
+    if (qstrcmp(argv[i],"-r")==0 && i+1<argc)
+    {
+      repeat=atoi(argv[++i]); // not inside QMAX, which evaluates its arguments twice
+      if (repeat<1) repeat=1;
+    }
+    else
+    {
+      readInput(argv[i],ids);
+    }
+  }
+  uint n = ids.count();
+  QCString *strs = new QCString[QMAX(n,1)];
+  QStrListIterator it(ids);
+  const char *id;
+  uint j=0;
+  for (it.toFirst();(id=it.current());++it) strs[j++]=id;
+
+  printf("%u identifiers, sizeof(QCString)=%d, inline up to %d characters (was %u)\n",
+         n,(int)sizeof(QCString),SHORT_STR_MAX_LEN,oldShortMaxLen);
+  printf("%-8s %10s | %19s | %21s\n","","","inline strings","heap blocks Mops/s");
+  printf("%-8s %10s | %9s %9s | %10s %10s\n","test","Mops/s","now","was","now","was");
+  report("create",benchCreate(ids,repeat),repeat);
+  report("copy",  benchCopy(strs,n,repeat),repeat);
+  report("concat",benchConcat(strs,n,repeat),repeat);
+
+  delete[] strs;
+  return 0;
+}
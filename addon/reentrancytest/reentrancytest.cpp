@@ -0,0 +1,378 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+/** @file
+ *  @brief Tests that instances of the reentrant C scanners are independent.
+ *
+ *  First the preprocessor and the comment converter are run over all files
+ *  on two threads at the same time, one going forward and one backward
+ *  through the files. Then two CLanguageScanner instances parse the files
+ *  in turns, and finally two threads, each with its own CLanguageScanner,
+ *  parse the files at the same time, taking their turns for the shared
+ *  state through a ParseOrder. Every result must be equal to that of a
+ *  serial run. The exit code is the number of files that gave a different
+ *  result, capped at 255.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <qdir.h>
+#include <qfileinfo.h>
+#include <qstrlist.h>
+#include <qgstring.h>
+#include <qthread.h>
+#include <qmutex.h>
+
+#include "doxygen.h"
+#include "config.h"
+#include "entry.h"
+#include "bufstr.h"
+#include "pre.h"
+#include "commentcnv.h"
+#include "scanner.h"
+#include "parseorder.h"
+#include "util.h"
+
+static void readInput(const char *name,QStrList &files)
+{
+  QFileInfo fi(name);
+  if (fi.isDir())
+  {
+    QDir dir(name);
+    dir.setFilter(QDir::Files);
+    dir.setSorting(QDir::Name);
+    const QFileInfoList *list = dir.entryInfoList();
+    if (list)
+    {
+      QFileInfoListIterator it(*list);
+      QFileInfo *cfi;
+      for (;(cfi=it.current());++it)
+      {
+        QCString ext = cfi->extension(FALSE).utf8();
+        if (ext=="c" || ext=="cpp" || ext=="cc" || ext=="h" || ext=="hpp")
+        {
+          files.append(cfi->absFilePath().utf8());
+        }
+      }
+    }
+  }
+  else if (fi.exists())
+  {
+    files.append(fi.absFilePath().utf8());
+  }
+}
+
+/** Returns the text the C scanner gets for \a fileName */
+static QCString preprocess(const char *fileName)
+{
+  QFileInfo fi(fileName);
+  BufStr inBuf(fi.size()+4096);
+  if (!readInputFile(fileName,inBuf)) return QCString();
+  BufStr preBuf(fi.size()+4096);
+  preprocessFile(fileName,inBuf.data(),inBuf.curPos(),preBuf);
+  if (preBuf.data() && preBuf.curPos()>0 && *(preBuf.data()+preBuf.curPos()-1)!='\n')
+  {
+    preBuf.addChar('\n');
+  }
+  BufStr convBuf(preBuf.curPos()+1024);
+  convertCppComments(&preBuf,&convBuf,fileName);
+  convBuf.addChar('\0');
+  return convBuf.data();
+}
+
+/** Appends \a s to \a out with the numbers of anonymous scopes removed,
+ *  since those depend on how many scopes were parsed before.
+ */
+static void addNormalized(QGString &out,const QCString &s)
+{
+  const char *p = s.data();
+  if (p==0) return;
+  char c;
+  while ((c=*p++))
+  {
+    out+=c;
+    if (c=='@') while (*p>='0' && *p<='9') p++;
+  }
+}
+
+static void dumpEntry(const Entry *e,int level,QGString &out)
+{
+  int i;
+  for (i=0;i<level;i++) out+="  ";
+  QCString section;
+  section.sprintf("%x ",e->section);
+  out+=section;
+  addNormalized(out,e->type);
+  out+='|';
+  addNormalized(out,e->name);
+  out+='|';
+  addNormalized(out,e->args);
+  out+='|';
+  addNormalized(out,e->brief);
+  out+='|';
+  addNormalized(out,e->doc);
+  out+='\n';
+  QListIterator<Entry> eli(*e->children());
+  const Entry *child;
+  for (;(child=eli.current());++eli)
+  {
+    dumpEntry(child,level+1,out);
+  }
+}
+
+/** Returns a dump of the Entry tree that \a scanner makes of \a fileName */
+static QCString parse(CLanguageScanner &scanner,const char *fileName,const QCString &text)
+{
+  Entry *root = new Entry;
+  QStrList filesInSameTu;
+  scanner.startTranslationUnit(fileName);
+  scanner.parseInput(fileName,text.data(),root,FALSE,filesInSameTu);
+  scanner.finishTranslationUnit();
+  QGString out;
+  dumpEntry(root,0,out);
+  delete root;
+  return out.data();
+}
+
+/** Preprocesses all files repeatedly and compares the results with the
+ *  results of a serial run.
+ */
+class PreprocessThread : public QThread
+{
+  public:
+    PreprocessThread(const QStrList &files,const QCString *expected,bool backward,int repeat)
+      : m_files(files), m_expected(expected), m_backward(backward), m_repeat(repeat),
+        m_failures(0) {}
+    void run()
+    {
+      uint n = m_files.count();
+      for (int r=0;r<m_repeat;r++)
+      {
+        for (uint i=0;i<n;i++)
+        {
+          uint f = m_backward ? n-1-i : i;
+          if (preprocess(m_files.at(f))!=m_expected[f])
+          {
+            if (m_failures==0) m_firstFailure=m_files.at(f);
+            m_failures++;
+          }
+        }
+      }
+    }
+    int failures() const { return m_failures; }
+    QCString firstFailure() const { return m_firstFailure; }
+  private:
+    QStrList        m_files; // own copy, QStrList::at() moves the current item
+    const QCString *m_expected;
+    bool            m_backward;
+    int             m_repeat;
+    int             m_failures;
+    QCString        m_firstFailure;
+};
+
+static int testPreprocessor(const QStrList &files,int repeat)
+{
+  QStrList fileList = files;
+  uint n = fileList.count(), i;
+  QCString *expected = new QCString[QMAX(n,1)];
+  // the first run records which headers have include guards, so only the
+  // second run gives the results that all later runs should give
+  for (i=0;i<n;i++) preprocess(fileList.at(i));
+  for (i=0;i<n;i++) expected[i]=preprocess(fileList.at(i));
+
+  PreprocessThread forward(files,expected,FALSE,repeat);
+  PreprocessThread backward(files,expected,TRUE,repeat);
+  qt_multiThreaded=TRUE;
+  forward.start();
+  backward.start();
+  forward.wait();
+  backward.wait();
+  qt_multiThreaded=FALSE;
+  delete[] expected;
+
+  int failures = forward.failures()+backward.failures();
+  printf("preprocessor: %u files on 2 threads, %d repeats: %d differences\n",n,repeat,failures);
+  if (forward.failures()>0)  printf("  first difference: %s\n",forward.firstFailure().data());
+  if (backward.failures()>0) printf("  first difference: %s\n",backward.firstFailure().data());
+  return failures;
+}
+
+static int testScanner(const QStrList &files)
+{
+  QStrList fileList = files;
+  uint n = fileList.count(), i;
+  QCString *text = new QCString[QMAX(n,1)];
+  QCString *first = new QCString[QMAX(n,1)];
+  for (i=0;i<n;i++) text[i]=preprocess(fileList.at(i));
+
+  CLanguageScanner scannerA,scannerB;
+  // scanner A parses the files forward while scanner B parses them backward,
+  // then both parse the files the other one parsed
+  for (i=0;i<n;i++)
+  {
+    first[i] = parse(scannerA,fileList.at(i),text[i]);
+    uint j = n-1-i;
+    if (j>i) first[j] = parse(scannerB,fileList.at(j),text[j]);
+  }
+  int failures=0;
+  for (i=0;i<n;i++)
+  {
+    uint j = n-1-i;
+    CLanguageScanner &scanner = j>i ? scannerA : scannerB;
+    if (parse(scanner,fileList.at(j),text[j])!=first[j])
+    {
+      if (failures==0) printf("  first difference: %s\n",fileList.at(j));
+      failures++;
+    }
+  }
+  delete[] text;
+  delete[] first;
+  printf("scanner: %u files with 2 instances: %d differences\n",n,failures);
+  return failures;
+}
+
+/** The files one round of the concurrent scanner test parses, in the order
+ *  in which the threads take them.
+ */
+struct ParseRound
+{
+  ParseRound(const QStrList &f,const QCString *t,const QCString *e,const uint *o)
+    : files(f), text(t), expected(e), order(o), next(0), failures(0), parseOrder(f.count()) {}
+  const QStrList &files;     // only copied, copying does not move the current item
+  const QCString *text;
+  const QCString *expected;
+  const uint     *order;     // file index for each position in the round
+  QMutex          mutex;
+  uint            next;      // next position to parse, guarded by mutex
+  int             failures;  // guarded by mutex
+  QCString        firstFailure;
+  ParseOrder      parseOrder;
+};
+
+/** Parses files of a round with its own scanner until none are left. */
+class ParseThread : public QThread
+{
+  public:
+    ParseThread(ParseRound &round) : m_round(round) {}
+    void run()
+    {
+      QStrList files = m_round.files; // own copy, QStrList::at() moves the current item
+      uint n = files.count();
+      while (TRUE)
+      {
+        uint pos;
+        {
+          QMutexLocker locker(&m_round.mutex);
+          if (m_round.next>=n) break;
+          pos = m_round.next++;
+        }
+        uint f = m_round.order[pos];
+        QCString result;
+        {
+          ParseOrder::Scope scope(m_round.parseOrder,pos);
+          result = parse(m_scanner,files.at(f),m_round.text[f]);
+        }
+        if (result!=m_round.expected[f])
+        {
+          QMutexLocker locker(&m_round.mutex);
+          if (m_round.failures==0) m_round.firstFailure=files.at(f);
+          m_round.failures++;
+        }
+      }
+    }
+  private:
+    ParseRound      &m_round;
+    CLanguageScanner m_scanner;
+};
+
+static int testConcurrentScanner(const QStrList &files,int repeat)
+{
+  QStrList fileList = files;
+  uint n = fileList.count(), i;
+  QCString *text = new QCString[QMAX(n,1)];
+  QCString *expected = new QCString[QMAX(n,1)];
+  uint *forward = new uint[QMAX(n,1)];
+  uint *backward = new uint[QMAX(n,1)];
+  CLanguageScanner scanner;
+  for (i=0;i<n;i++)
+  {
+    text[i]=preprocess(fileList.at(i));
+    expected[i]=parse(scanner,fileList.at(i),text[i]);
+    forward[i]=i;
+    backward[i]=n-1-i;
+  }
+
+  int failures=0;
+  for (int r=0;r<repeat;r++)
+  {
+    // alternate the order so each file follows different files
+    ParseRound round(files,text,expected,r%2==0 ? forward : backward);
+    ParseThread threadA(round),threadB(round);
+    qt_multiThreaded=TRUE;
+    threadA.start();
+    threadB.start();
+    threadA.wait();
+    threadB.wait();
+    qt_multiThreaded=FALSE;
+    if (round.failures>0 && failures==0)
+    {
+      printf("  first difference: %s\n",round.firstFailure.data());
+    }
+    failures+=round.failures;
+  }
+  delete[] text;
+  delete[] expected;
+  delete[] forward;
+  delete[] backward;
+  printf("scanner: %u files on 2 threads, %d repeats: %d differences\n",n,repeat,failures);
+  return failures;
+}
+
+int main(int argc,char **argv)
+{
+  if (argc<2)
+  {
+    printf("Usage: %s [-r repeat] file_or_dir...\n",argv[0]);
+    exit(1);
+  }
+  int repeat=3;
+  QStrList files;
+  for (int i=1;i<argc;i++)
+  {
+    if (qstrcmp(argv[i],"-r")==0 && i+1<argc)
+    {
+      repeat=atoi(argv[++i]);
+      if (repeat<1) repeat=1;
+    }
+    else
+    {
+      readInput(argv[i],files);
+    }
+  }
+
+  initDoxygen();
+  Config::init();
+  checkConfiguration();
+  adjustConfiguration();
+  Config_getBool(QUIET)=TRUE;
+  Config_getBool(WARNINGS)=FALSE;
+  Config_getBool(WARN_IF_UNDOCUMENTED)=FALSE;
+  Config_getBool(WARN_IF_DOC_ERROR)=FALSE;
+
+  int failures = testPreprocessor(files,repeat)+testScanner(files)+
+                 testConcurrentScanner(files,repeat);
+  return QMIN(failures,255);
+}
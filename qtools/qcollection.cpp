@@ -36,6 +36,7 @@
 **********************************************************************/
 
 #include "qcollection.h"
+#include "qmutex.h"
 
 // NOT REVISED
 /*!
@@ -180,3 +181,34 @@ void QCollection::deleteItem( Item d )
 	delete d;				// default operation
 #endif
 }
+
+
+/*!
+  \class QIteratorLocker qcollection.h
+  \brief The QIteratorLocker class is an internal class that guards the
+  registration of iterators.
+
+  List and dictionary iterators attach themselves to the collection they
+  walk, so even reading a collection through an iterator changes it.
+  While qt_multiThreaded is set, several threads may walk the same
+  collection, so the attaching and detaching is done under a lock that
+  is held for the lifetime of a QIteratorLocker.
+*/
+
+static QMutex *iteratorMutex()
+{
+    static QMutex mutex;
+    return &mutex;
+}
+
+QIteratorLocker::QIteratorLocker() : locked( qt_multiThreaded )
+{
+    if ( locked )
+	iteratorMutex()->lock();
+}
+
+QIteratorLocker::~QIteratorLocker()
+{
+    if ( locked )
+	iteratorMutex()->unlock();
+}
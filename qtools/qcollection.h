@@ -71,4 +71,14 @@ protected:
 };
 
 
+class Q_EXPORT QIteratorLocker			// guards iterator registration
+{
+public:
+    QIteratorLocker();
+   ~QIteratorLocker();
+private:
+    bool locked;
+};
+
+
 #endif // QCOLLECTION_H
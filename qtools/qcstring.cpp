@@ -634,7 +634,7 @@ QDataStream &operator>>( QDataStream &s, QCString &str )
 	str.resize( 0 );
 	return s;
     }
-    if ( !str.resize( (uint)len )) {// resize string
+    if ( !str.resize( (uint)len+1 )) {// resize string (+1 for the 0-terminator)
 #if defined(CHECK_NULL)
 	qWarning( "QDataStream: Not enough memory to read QCString" );
 #endif
@@ -24,6 +24,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <new>
+#include <atomic>
 
 #if !defined(_OS_WIN32_) || defined(__MINGW32__)
 #include <stdint.h>
@@ -346,7 +348,9 @@ public:
       LSData *d;
     };
 
-#define SHORT_STR_CAPACITY ((int)sizeof(LongStringRep)-2)
+// short strings are stored inline in the space of three pointers, which
+// covers most identifiers without a heap allocation
+#define SHORT_STR_CAPACITY ((int)(3*sizeof(void*))-2)
 #define SHORT_STR_MAX_LEN (SHORT_STR_CAPACITY-1)
 
     // short string representation
@@ -360,8 +364,8 @@ public:
     // ref counting string header
     struct LSHeader
     {
-      int           len;      // length of string without 0 terminator
-      int           refCount; // -1=leaked, 0=one ref & non-cost, n>0, n+1 refs, const
+      int              len;      // length of string without 0 terminator
+      std::atomic<int> refCount; // -1=leaked, 0=one ref & non-cost, n>0, n+1 refs, const
     };
     // ref counting string data and methods
     struct LSData : public LSHeader
@@ -376,25 +380,38 @@ public:
       static LSData *create(int size)
       {
         LSData *data;
-        data = (LSData*)malloc(sizeof(LSHeader)+size);
+        data = new (malloc(sizeof(LSHeader)+size)) LSData;
         data->len = size-1;
-        data->refCount = 0;
+        data->refCount.store(0,std::memory_order_relaxed);
         data->toStr()[size-1] = 0;
         return data;
       }
+      // adds delta to the reference count and returns the new count,
+      // the update is only atomic while other threads may share the data
+      int addRef(int delta)
+      {
+        if (qt_multiThreaded)
+        {
+          return refCount.fetch_add(delta,std::memory_order_acq_rel)+delta;
+        }
+        int count = refCount.load(std::memory_order_relaxed)+delta;
+        refCount.store(count,std::memory_order_relaxed);
+        return count;
+      }
       // remove out reference to the data. Frees memory if no more users
       void dispose()
       {
-        if (--refCount<0) free(this);
+        if (addRef(-1)<0) free(this);
       }
 
       // resizes LSData so it can hold size bytes (which includes the 0 terminator!)
       // Since this is for long strings only, size should be > SHORT_STR_CAPACITY
       static LSData *resize(LSData *d,int size)
       {
-        if (d->len>0 && d->refCount==0) // non-const, non-empty
+        if (d->len>0 && d->refCount.load(std::memory_order_acquire)==0) // non-const, non-empty
         {
-          d = (LSData*)realloc(d,sizeof(LSHeader)+size);
+          d = new (realloc(d,sizeof(LSHeader)+size)) LSData;
+          d->refCount.store(0,std::memory_order_relaxed);
           d->len = size-1;
           d->toStr()[size-1] = 0;
           return d;
@@ -445,7 +462,7 @@ public:
             else
             {
               u.l.d = s.u.l.d;
-              u.l.d->refCount++;
+              u.l.d->addRef(1);
             }
           }
           else // self-assignment
@@ -536,7 +553,7 @@ public:
             else // copy by reference
             {
               u.l.d = s.u.l.d;
-              u.l.d->refCount++;
+              u.l.d->addRef(1);
             }
           }
           else // self-assignment
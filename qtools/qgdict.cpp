@@ -40,6 +40,10 @@
 #include "qstring.h"
 #include "qdatastream.h"
 #include <ctype.h>
+#include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // NOT REVISED
 /*!
@@ -74,6 +78,335 @@ public:
 };
 
 
+/*****************************************************************************
+  QGDictIndex: open addressing index of the buckets
+ *****************************************************************************/
+
+/*
+  Finding a key in the bucket chains takes time proportional to the number
+  of items divided by the size of the hash array, and many dictionaries
+  are created with a small size and never resized. So once a dictionary
+  holds more items than its hash array has entries, an index of all
+  buckets is built, which is grown to stay at most 7/8 full.
+
+  Each slot of the index has a control byte that marks it as empty or
+  deleted or holds 7 bits of the hash value of its key. The control
+  bytes of a group of 16 slots are compared to those bits at once, so a
+  key is usually found after looking at a single group.
+
+  The buckets stay linked in their chains, so the iteration order and the
+  iterators are not affected by the index. If a key was inserted more
+  than once, the item inserted last is found, as in the chains.
+*/
+
+static bool qgdict_indexEnabled = TRUE;
+
+static const uint  indexMinItems = 16;
+static const uint  groupSize     = 16;
+static const uchar ctrlEmpty     = 0x80;
+static const uchar ctrlDeleted   = 0xfe;
+
+struct QGDictIndex
+{
+    struct Slot
+    {
+	QBaseBucket *node;
+	uint	     hash;		// hash value of the key
+	uint	     seq;		// insertion order, for duplicate keys
+    };
+    QGDictIndex( uint size )		// size must be a power of 2 >= groupSize
+	: mask(size-1), used(0), deleted(0), seq(0), dupKeys(FALSE)
+    {
+	ctrl  = new uchar[size+groupSize];
+	slots = new Slot[size];
+	memset( ctrl, ctrlEmpty, size+groupSize );
+    }
+   ~QGDictIndex() { delete [] ctrl; delete [] slots; }
+    uint size() const { return mask+1; }
+    void setCtrl( uint i, uchar c )
+    {
+	ctrl[i] = c;
+	if ( i < groupSize )		// mirrored after the end, so a group
+	    ctrl[size()+i] = c;		// can be read at every position
+    }
+    uint   mask;
+    uint   used;
+    uint   deleted;
+    uint   seq;
+    bool   dupKeys;			// TRUE if a key was inserted twice
+    uchar *ctrl;
+    Slot  *slots;
+};
+
+// scrambles the hash value, as the index only uses its lower bits
+static inline uint indexHash( uint h )
+{
+    h ^= h >> 15;
+    h *= 0x2c1b3c6d;
+    h ^= h >> 12;
+    return h;
+}
+
+static inline uchar indexTag( uint h )
+{
+    return (uchar)(h >> 25);
+}
+
+// returns a bit mask of the control bytes in the group at g equal to c
+static inline uint matchGroup( const uchar *g, uchar c )
+{
+#if defined(__SSE2__)
+    __m128i v = _mm_loadu_si128( (const __m128i*)g );
+    return (uint)_mm_movemask_epi8( _mm_cmpeq_epi8(v,_mm_set1_epi8((char)c)) );
+#else
+    uint m = 0;
+    for ( uint i=0; i<groupSize; i++ )
+	if ( g[i] == c ) m |= 1u << i;
+    return m;
+#endif
+}
+
+// returns a bit mask of the empty or deleted slots in the group at g
+static inline uint matchFree( const uchar *g )
+{
+#if defined(__SSE2__)
+    return (uint)_mm_movemask_epi8( _mm_loadu_si128((const __m128i*)g) );
+#else
+    uint m = 0;
+    for ( uint i=0; i<groupSize; i++ )
+	if ( g[i] & 0x80 ) m |= 1u << i;
+    return m;
+#endif
+}
+
+static inline uint lowestBit( uint m )
+{
+#if defined(__GNUC__)
+    return (uint)__builtin_ctz( m );
+#else
+    uint i = 0;
+    while ( !(m & 1) ) { m >>= 1; i++; }
+    return i;
+#endif
+}
+
+/*!
+  Enables or disables the index of large dictionaries.
+  Only intended for measuring its effect, it affects dictionaries created
+  or filled after the call.
+*/
+void QGDict::setIndexEnabled( bool enable )
+{
+    qgdict_indexEnabled = enable;
+}
+
+bool QGDict::indexEnabled()
+{
+    return qgdict_indexEnabled;
+}
+
+bool QGDict::sameKey( QBaseBucket *n, const char *akey, intptr_t ikey ) const
+{
+    switch ( keytype ) {
+	case AsciiKey:
+	    return (cases ? qstrcmp(((QAsciiBucket*)n)->getKey(),akey)
+			  : qstricmp(((QAsciiBucket*)n)->getKey(),akey)) == 0;
+	case IntKey:
+	    return ((QIntBucket*)n)->getKey() == ikey;
+	case PtrKey:
+	    return (intptr_t)((QPtrBucket*)n)->getKey() == ikey;
+	default:
+	    return FALSE;
+    }
+}
+
+bool QGDict::sameKey( QBaseBucket *n, QBaseBucket *m ) const
+{
+    switch ( keytype ) {
+	case AsciiKey:
+	    return sameKey( n, ((QAsciiBucket*)m)->getKey(), 0 );
+	case IntKey:
+	    return sameKey( n, 0, ((QIntBucket*)m)->getKey() );
+	case PtrKey:
+	    return sameKey( n, 0, (intptr_t)((QPtrBucket*)m)->getKey() );
+	default:
+	    return FALSE;
+    }
+}
+
+/*!
+  \internal
+  Returns the bucket with the key \a akey or \a ikey, depending on the key
+  type, using the index. \a h is the full hash value of the key.
+*/
+QBaseBucket *QGDict::index_find( uint h, const char *akey, intptr_t ikey ) const
+{
+    QGDictIndex *x = lookupIndex;
+    uint hash = indexHash( h );
+    uchar tag = indexTag( hash );
+    uint pos = hash & x->mask;
+    QBaseBucket *best = 0;
+    uint bestSeq = 0;
+    for (;;) {
+	const uchar *g = x->ctrl + pos;
+	uint m = matchGroup( g, tag );
+	while ( m ) {
+	    uint i = (pos + lowestBit(m)) & x->mask;
+	    QGDictIndex::Slot &s = x->slots[i];
+	    if ( s.hash == h && sameKey(s.node,akey,ikey) ) {
+		if ( !x->dupKeys )
+		    return s.node;
+		if ( best == 0 || s.seq > bestSeq ) {
+		    best = s.node;
+		    bestSeq = s.seq;
+		}
+	    }
+	    m &= m - 1;
+	}
+	if ( matchGroup(g,ctrlEmpty) )	// key cannot be further on
+	    return best;
+	pos = (pos + groupSize) & x->mask;
+    }
+}
+
+/*!
+  \internal
+  Adds the bucket \a n that was just inserted into the chains to the
+  index, and creates the index if the chains have become too long.
+*/
+void QGDict::index_add( QBaseBucket *n, uint h )
+{
+    if ( lookupIndex ) {
+	index_insert( n, h, ++lookupIndex->seq );
+    } else if ( numItems > vlen && numItems >= indexMinItems &&
+		qgdict_indexEnabled && keytype != StringKey ) {
+	index_build();
+    }
+}
+
+void QGDict::index_insert( QBaseBucket *n, uint h, uint seq )
+{
+    QGDictIndex *x = lookupIndex;
+    if ( (x->used + x->deleted + 1)*8 > x->size()*7 ) {
+	index_rehash( x->used*16 > x->size()*7 ? x->size()*2 : x->size() );
+	x = lookupIndex;
+    }
+    uint hash = indexHash( h );
+    uchar tag = indexTag( hash );
+    uint pos = hash & x->mask;
+    int target = -1;
+    for (;;) {
+	const uchar *g = x->ctrl + pos;
+	if ( !x->dupKeys ) {		// check if the key is already present
+	    uint m = matchGroup( g, tag );
+	    while ( m ) {
+		QGDictIndex::Slot &s = x->slots[(pos + lowestBit(m)) & x->mask];
+		if ( s.hash == h && sameKey(s.node,n) )
+		    x->dupKeys = TRUE;
+		m &= m - 1;
+	    }
+	}
+	if ( target == -1 ) {
+	    uint m = matchFree( g );
+	    if ( m )
+		target = (int)((pos + lowestBit(m)) & x->mask);
+	}
+	if ( matchGroup(g,ctrlEmpty) || (target != -1 && x->dupKeys) )
+	    break;
+	pos = (pos + groupSize) & x->mask;
+    }
+    if ( x->ctrl[target] == ctrlDeleted )
+	x->deleted--;
+    x->used++;
+    x->setCtrl( target, tag );
+    x->slots[target].node = n;
+    x->slots[target].hash = h;
+    x->slots[target].seq  = seq;
+}
+
+void QGDict::index_remove( QBaseBucket *n, uint h )
+{
+    QGDictIndex *x = lookupIndex;
+    uint hash = indexHash( h );
+    uchar tag = indexTag( hash );
+    uint pos = hash & x->mask;
+    for (;;) {
+	const uchar *g = x->ctrl + pos;
+	uint m = matchGroup( g, tag );
+	while ( m ) {
+	    uint i = (pos + lowestBit(m)) & x->mask;
+	    if ( x->slots[i].node == n ) {
+		x->setCtrl( i, ctrlDeleted );
+		x->used--;
+		x->deleted++;
+		return;
+	    }
+	    m &= m - 1;
+	}
+	if ( matchGroup(g,ctrlEmpty) )	// not in the index
+	    return;
+	pos = (pos + groupSize) & x->mask;
+    }
+}
+
+void QGDict::index_rehash( uint size )
+{
+    QGDictIndex *old = lookupIndex;
+    QGDictIndex *x = new QGDictIndex( size );
+    x->seq     = old->seq;
+    x->dupKeys = old->dupKeys;
+    for ( uint i=0; i<old->size(); i++ ) {
+	if ( !(old->ctrl[i] & 0x80) ) {
+	    const QGDictIndex::Slot &s = old->slots[i];
+	    uint hash = indexHash( s.hash );
+	    uint pos = hash & x->mask;
+	    uint m;
+	    while ( !(m = matchFree(x->ctrl + pos)) )
+		pos = (pos + groupSize) & x->mask;
+	    uint j = (pos + lowestBit(m)) & x->mask;
+	    x->setCtrl( j, indexTag(hash) );
+	    x->slots[j] = s;
+	    x->used++;
+	}
+    }
+    delete old;
+    lookupIndex = x;
+}
+
+/*!
+  \internal
+  Creates the index of all buckets in the chains.
+*/
+void QGDict::index_build()
+{
+    uint size = 64;
+    while ( size < numItems*2 )
+	size *= 2;
+    lookupIndex = new QGDictIndex( size );
+    uint seq = 0;
+    for ( uint j=0; j<vlen; j++ ) {
+	uint len = 0;
+	QBaseBucket *n;
+	for ( n=vec[j]; n; n=n->getNext() )
+	    len++;
+	// the first bucket in a chain was inserted last
+	uint i = len;
+	for ( n=vec[j]; n; n=n->getNext() ) {
+	    uint h;
+	    switch ( keytype ) {
+		case AsciiKey: h = (uint)hashKeyAscii( ((QAsciiBucket*)n)->getKey() ); break;
+		case IntKey:   h = (uint)((QIntBucket*)n)->getKey(); break;
+		default:       h = (uint)(uintptr_t)((QPtrBucket*)n)->getKey(); break;
+	    }
+	    index_insert( n, h, seq + --i );
+	}
+	seq += len;
+    }
+    lookupIndex->seq = seq;
+}
+
+
+
 /*****************************************************************************
   Default implementation of special and virtual functions
  *****************************************************************************/
@@ -232,6 +565,7 @@ void QGDict::init( uint len, KeyType kt, bool caseSensitive, bool copyKeys )
     memset( (char*)vec, 0, vlen*sizeof(QBaseBucket*) );
     numItems  = 0;
     iterators = 0;
+    lookupIndex = 0;
     // The caseSensitive and copyKey options don't make sense for
     // all dict types.
     switch ( (keytype = (uint)kt) ) {
@@ -290,6 +624,7 @@ QGDict::~QGDict()
 {
     clear();					// delete everything
     delete [] vec;
+    delete lookupIndex;
     if ( !iterators )				// no iterators for this dict
 	return;
     QGDictIterator *i = iterators->first();
@@ -422,8 +757,13 @@ QCollection::Item QGDict::look_string( const QString &key, QCollection::Item d,
 QCollection::Item QGDict::look_ascii( const char *key, QCollection::Item d, int op )
 {
     QAsciiBucket *n;
-    int	index = hashKeyAscii(key) % vlen;
+    uint hash = (uint)hashKeyAscii(key);
+    int	index = hash % vlen;
     if ( op == op_find ) {			// find
+	if ( lookupIndex ) {
+	    n = (QAsciiBucket*)index_find( hash, key, 0 );
+	    return n ? n->getData() : 0;
+	}
 	if ( cases ) {
 	    for ( n=(QAsciiBucket*)vec[index]; n;
 		  n=(QAsciiBucket*)n->getNext() ) {
@@ -452,6 +792,7 @@ QCollection::Item QGDict::look_ascii( const char *key, QCollection::Item d, int
 #endif
     vec[index] = n;
     numItems++;
+    index_add( n, hash );
     return n->getData();
 }
 
@@ -463,6 +804,10 @@ QCollection::Item QGDict::look_int( long key, QCollection::Item d, int op )
     QIntBucket *n;
     int index = (int)((ulong)key % vlen);	// simple hash
     if ( op == op_find ) {			// find
+	if ( lookupIndex ) {
+	    n = (QIntBucket*)index_find( (uint)key, 0, key );
+	    return n ? n->getData() : 0;
+	}
 	for ( n=(QIntBucket*)vec[index]; n;
 	      n=(QIntBucket*)n->getNext() ) {
 	    if ( n->getKey() == key )
@@ -483,6 +828,7 @@ QCollection::Item QGDict::look_int( long key, QCollection::Item d, int op )
 #endif
     vec[index] = n;
     numItems++;
+    index_add( n, (uint)key );
     return n->getData();
 }
 
@@ -494,6 +840,10 @@ QCollection::Item QGDict::look_ptr( void *key, QCollection::Item d, int op )
     QPtrBucket *n;
     int index = (int)((uintptr_t)key % vlen);	// simple hash
     if ( op == op_find ) {			// find
+	if ( lookupIndex ) {
+	    n = (QPtrBucket*)index_find( (uint)(uintptr_t)key, 0, (intptr_t)key );
+	    return n ? n->getData() : 0;
+	}
 	for ( n=(QPtrBucket*)vec[index]; n;
 	      n=(QPtrBucket*)n->getNext() ) {
 	    if ( n->getKey() == key )
@@ -514,6 +864,7 @@ QCollection::Item QGDict::look_ptr( void *key, QCollection::Item d, int op )
 #endif
     vec[index] = n;
     numItems++;
+    index_add( n, (uint)(uintptr_t)key );
     return n->getData();
 }
 
@@ -531,6 +882,9 @@ void QGDict::resize( uint newsize )
     uint old_vlen  = vlen;
     bool old_copyk = copyk;
 
+    delete lookupIndex;				// rebuilt while reinserting
+    lookupIndex = 0;
+
     vec = new QBaseBucket *[vlen = newsize];
     CHECK_PTR( vec );
     memset( (char*)vec, 0, vlen*sizeof(QBaseBucket*) );
@@ -607,7 +961,8 @@ void QGDict::resize( uint newsize )
   if it is set).
 */
 
-void QGDict::unlink_common( int index, QBaseBucket *node, QBaseBucket *prev )
+void QGDict::unlink_common( int index, QBaseBucket *node, QBaseBucket *prev,
+			    uint hash )
 {
     if ( iterators && iterators->count() ) {	// update iterators
 	QGDictIterator *i = iterators->first();
@@ -622,6 +977,8 @@ void QGDict::unlink_common( int index, QBaseBucket *node, QBaseBucket *prev )
     else
 	vec[index] = node->getNext();
     numItems--;
+    if ( lookupIndex )
+	index_remove( node, hash );
 }
 
 QStringBucket *QGDict::unlink_string( const QString &key, QCollection::Item d )
@@ -638,7 +995,7 @@ QStringBucket *QGDict::unlink_string( const QString &key, QCollection::Item d )
 	    if ( found && d )
 		found = (n->getData() == d);
 	    if ( found ) {
-		unlink_common(index,n,prev);
+		unlink_common(index,n,prev,0);
 		return n;
 	    }
 	    prev = n;
@@ -651,7 +1008,7 @@ QStringBucket *QGDict::unlink_string( const QString &key, QCollection::Item d )
 	    if ( found && d )
 		found = (n->getData() == d);
 	    if ( found ) {
-		unlink_common(index,n,prev);
+		unlink_common(index,n,prev,0);
 		return n;
 	    }
 	    prev = n;
@@ -666,14 +1023,15 @@ QAsciiBucket *QGDict::unlink_ascii( const char *key, QCollection::Item d )
 	return 0;
     QAsciiBucket *n;
     QAsciiBucket *prev = 0;
-    int index = hashKeyAscii(key) % vlen;	
+    uint hash = (uint)hashKeyAscii(key);
+    int index = hash % vlen;	
     for ( n=(QAsciiBucket *)vec[index]; n; n=(QAsciiBucket *)n->getNext() ) {
 	bool found = (cases ? qstrcmp(n->getKey(),key)
 		       : qstricmp(n->getKey(),key)) == 0;
 	if ( found && d )
 	    found = (n->getData() == d);
 	if ( found ) {
-	    unlink_common(index,n,prev);
+	    unlink_common(index,n,prev,hash);
 	    return n;
 	}
 	prev = n;
@@ -693,7 +1051,7 @@ QIntBucket *QGDict::unlink_int( long key, QCollection::Item d )
 	if ( found && d )
 	    found = (n->getData() == d);
 	if ( found ) {
-	    unlink_common(index,n,prev);
+	    unlink_common(index,n,prev,(uint)key);
 	    return n;
 	}
 	prev = n;
@@ -713,7 +1071,7 @@ QPtrBucket *QGDict::unlink_ptr( void *key, QCollection::Item d )
 	if ( found && d )
 	    found = (n->getData() == d);
 	if ( found ) {
-	    unlink_common(index,n,prev);
+	    unlink_common(index,n,prev,(uint)(uintptr_t)key);
 	    return n;
 	}
 	prev = n;
@@ -912,6 +1270,8 @@ void QGDict::clear()
 	    vec[j] = 0;				// detach list of buckets
 	}
     }
+    delete lookupIndex;
+    lookupIndex = 0;
     if ( iterators && iterators->count() ) {	// invalidate all iterators
 	QGDictIterator *i = iterators->first();
 	while ( i ) {
@@ -1102,6 +1462,7 @@ QGDictIterator::QGDictIterator( const QGDict &d )
 {
     dict = (QGDict *)&d;			// get reference to dict
     toFirst();					// set to first node
+    QIteratorLocker locker;
     if ( !dict->iterators ) {
 	dict->iterators = new QGDItList;	// create iterator list
 	CHECK_PTR( dict->iterators );
@@ -1119,6 +1480,7 @@ QGDictIterator::QGDictIterator( const QGDictIterator &it )
     dict = it.dict;
     curNode = it.curNode;
     curIndex = it.curIndex;
+    QIteratorLocker locker;
     if ( dict )
 	dict->iterators->append( this );	// attach iterator to dict
 }
@@ -1131,6 +1493,7 @@ QGDictIterator::QGDictIterator( const QGDictIterator &it )
 
 QGDictIterator &QGDictIterator::operator=( const QGDictIterator &it )
 {
+    QIteratorLocker locker;
     if ( dict )					// detach from old dict
 	dict->iterators->removeRef( this );
     dict = it.dict;
@@ -1148,6 +1511,7 @@ QGDictIterator &QGDictIterator::operator=( const QGDictIterator &it )
 
 QGDictIterator::~QGDictIterator()
 {
+    QIteratorLocker locker;
     if ( dict )					// detach iterator from dict
 	dict->iterators->removeRef( this );
 }
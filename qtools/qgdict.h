@@ -45,6 +45,7 @@
 
 class QGDictIterator;
 class QGDItList;
+struct QGDictIndex;
 
 
 class QBaseBucket				// internal dict node
@@ -115,6 +116,9 @@ public:
     QDataStream &read( QDataStream & );
     QDataStream &write( QDataStream & ) const;
 #endif
+
+    static void setIndexEnabled( bool );
+    static bool indexEnabled();
 protected:
     enum KeyType { StringKey, AsciiKey, IntKey, PtrKey };
 
@@ -153,13 +157,22 @@ private:
     uint	cases	: 1;
     uint	copyk	: 1;
     QGDItList  *iterators;
-    void	   unlink_common( int, QBaseBucket *, QBaseBucket * );
+    QGDictIndex *lookupIndex;
+    void	   unlink_common( int, QBaseBucket *, QBaseBucket *, uint );
     QStringBucket *unlink_string( const QString &,
 				  QCollection::Item item = 0 );
     QAsciiBucket  *unlink_ascii( const char *, QCollection::Item item = 0 );
     QIntBucket    *unlink_int( long, QCollection::Item item = 0 );
     QPtrBucket    *unlink_ptr( void *, QCollection::Item item = 0 );
     void	init( uint, KeyType, bool, bool );
+    bool	sameKey( QBaseBucket *, const char *, intptr_t ) const;
+    bool	sameKey( QBaseBucket *, QBaseBucket * ) const;
+    QBaseBucket *index_find( uint, const char *, intptr_t ) const;
+    void	index_add( QBaseBucket *, uint );
+    void	index_insert( QBaseBucket *, uint, uint );
+    void	index_remove( QBaseBucket *, uint );
+    void	index_rehash( uint );
+    void	index_build();
     friend class QGDictIterator;
 };
 
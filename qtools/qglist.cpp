@@ -1056,6 +1056,7 @@ QGListIterator::QGListIterator( const QGList &l )
 {
     list = (QGList *)&l;			// get reference to list
     curNode = list->firstNode;			// set to first node
+    QIteratorLocker locker;
     if ( !list->iterators ) {
 	list->iterators = new QGList;		// create iterator list
 	CHECK_PTR( list->iterators );
@@ -1072,6 +1073,7 @@ QGListIterator::QGListIterator( const QGListIterator &it )
 {
     list = it.list;
     curNode = it.curNode;
+    QIteratorLocker locker;
     if ( list )
 	list->iterators->append( this );	// attach iterator to list
 }
@@ -1084,6 +1086,7 @@ QGListIterator::QGListIterator( const QGListIterator &it )
 
 QGListIterator &QGListIterator::operator=( const QGListIterator &it )
 {
+    QIteratorLocker locker;
     if ( list )					// detach from old list
 	list->iterators->removeRef( this );
     list = it.list;
@@ -1100,6 +1103,7 @@ QGListIterator &QGListIterator::operator=( const QGListIterator &it )
 
 QGListIterator::~QGListIterator()
 {
+    QIteratorLocker locker;
     if ( list )					// detach iterator from list
 	list->iterators->removeRef(this);
 }
@@ -683,3 +683,5 @@ msg_handler qInstallMsgHandler( msg_handler h )
 #ifdef _WS_WIN_
 bool qt_winunicode=FALSE;
 #endif
+
+bool qt_multiThreaded=FALSE;
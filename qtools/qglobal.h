@@ -597,6 +597,11 @@ Q_EXPORT void fatal( const char *, ... )	// print fatal message and exit
 #endif
 #endif
 
+// Set while several threads share Qt objects. Reference counts are then
+// changed atomically and iterators register themselves under a lock.
+// Only change it while no other threads are running.
+Q_EXPORT extern bool qt_multiThreaded;
+
 Q_EXPORT bool qt_check_pointer( bool c, const char *, int );
 
 #if defined(CHECK_NULL)
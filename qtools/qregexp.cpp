@@ -902,7 +902,7 @@ static uint *dump( uint *p )
 
 
 static const int maxlen = 1024;			// max length of regexp array
-static uint rxarray[ maxlen ];			// tmp regexp array
+static thread_local uint rxarray[ maxlen ];	// tmp regexp array
 
 /*!
   \internal
@@ -42,13 +42,29 @@
 #include "qglobal.h"
 #endif // QT_H
 
+#include <atomic>
+
 
 struct QShared
 {
-    QShared()		{ count = 1; }
-    void ref()		{ count++; }
-    bool deref()	{ return !--count; }
-    uint count;
+    QShared() : count(1) {}
+    QShared( const QShared & ) : count(1) {}
+    void ref()
+    {
+	if ( qt_multiThreaded )
+	    count.fetch_add( 1, std::memory_order_relaxed );
+	else
+	    count.store( count.load(std::memory_order_relaxed)+1, std::memory_order_relaxed );
+    }
+    bool deref()
+    {
+	if ( qt_multiThreaded )
+	    return count.fetch_sub( 1, std::memory_order_acq_rel )==1;
+	uint n = count.load(std::memory_order_relaxed)-1;
+	count.store( n, std::memory_order_relaxed );
+	return !n;
+    }
+    std::atomic<uint> count;			// atomic while qt_multiThreaded is set
 };
 
 
@@ -12779,9 +12779,8 @@ QString &QString::sprintf( const char* cformat, ... )
     }
     QString format = QString::fromLatin1( cformat );
 
-    static QRegExp *escape = 0;
-    if (!escape)
-	escape = new QRegExp( "%#?0?-? ?\\+?'?[0-9*]*\\.?[0-9*]*h?l?L?q?Z?" );
+    static QRegExp *escape =
+	new QRegExp( "%#?0?-? ?\\+?'?[0-9*]*\\.?[0-9*]*h?l?L?q?Z?" );
 
     QString result;
     uint last = 0;
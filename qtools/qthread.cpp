@@ -49,9 +49,11 @@ QThread::QThread()
 
 QThread::~QThread()
 {
-   QMutexLocker locker(&d->mutex);
-   if (d->running && !d->finished)
-      qWarning("QThread: Destroyed while thread is still running");
+   {
+      QMutexLocker locker(&d->mutex);
+      if (d->running && !d->finished)
+         qWarning("QThread: Destroyed while thread is still running");
+   } // unlock before the mutex is deleted
    delete d;
 }
 
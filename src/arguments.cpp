@@ -1,6 +1,11 @@
-#include "arguments.h"
 #include <assert.h>
 
+#include <qdict.h>
+#include <qgstring.h>
+#include <qmutex.h>
+
+#include "arguments.h"
+
 /*! the argument list is documented if one of its
  *  arguments is documented 
  */
@@ -37,3 +42,158 @@ ArgumentList *ArgumentList::deepCopy() const
   return argList;
 }
 
+
+//----------------------------------------------------------------------------
+
+/** Pool of shared, immutable argument lists.
+ *
+ *  Many members have the same argument list, e.g. \c () or \c (int), so
+ *  members store pooled copies rather than private ones. Pooled lists are
+ *  kept alive until the end of the run, so a pointer to a pooled list
+ *  stays valid even after its last user has released it.
+ */
+struct ArgumentListPool
+{
+  ArgumentListPool() : lists(10007), numRequests(0), numShared(0) {}
+  QDict<ArgumentList> lists;
+  QMutex mutex;
+  uint numRequests;
+  uint numShared;
+};
+
+static ArgumentListPool *g_argumentListPool = 0;
+
+static ArgumentListPool *argumentListPool()
+{
+  if (g_argumentListPool==0) g_argumentListPool = new ArgumentListPool;
+  return g_argumentListPool;
+}
+
+static void addKeyField(QGString &key,const QCString &s)
+{
+  key+=s;
+  key+='\001';
+}
+
+/*! Returns a key that is equal for two lists if and only if the lists
+ *  have the same content, ignoring the cached canonical types.
+ */
+static QCString poolKey(const ArgumentList *al)
+{
+  QGString key;
+  key+=al->constSpecifier    ? 'c' : '-';
+  key+=al->volatileSpecifier ? 'v' : '-';
+  key+=al->pureSpecifier     ? 'p' : '-';
+  key+=al->isDeleted         ? 'd' : '-';
+  key+=(char)('0'+al->refQualifier);
+  addKeyField(key,al->trailingReturnType);
+  ArgumentListIterator ali(*al);
+  const Argument *a;
+  for (;(a=ali.current());++ali)
+  {
+    key+='\002';
+    addKeyField(key,a->attrib);
+    addKeyField(key,a->type);
+    addKeyField(key,a->name);
+    addKeyField(key,a->array);
+    addKeyField(key,a->defval);
+    addKeyField(key,a->docs);
+    addKeyField(key,a->typeConstraint);
+  }
+  return key.data();
+}
+
+/*! Returns TRUE if \a type only consists of builtin type keywords and
+ *  punctuation, so it resolves to the same type in every scope.
+ */
+static bool isBuiltinType(const QCString &type)
+{
+  static const char *builtins[] =
+  {
+    "void", "bool", "char", "wchar_t", "char16_t", "char32_t",
+    "short", "int", "long", "signed", "unsigned", "float", "double",
+    "const", "volatile", 0
+  };
+  const char *p = type.data();
+  if (p==0) return TRUE;
+  while (*p)
+  {
+    char c=*p;
+    if ((c>='a' && c<='z') || (c>='A' && c<='Z') || c=='_')
+    {
+      const char *s=p;
+      while ((c>='a' && c<='z') || (c>='A' && c<='Z') || (c>='0' && c<='9') || c=='_') c=*++p;
+      int len=(int)(p-s);
+      const char **b;
+      for (b=builtins;*b;b++)
+      {
+        if ((int)qstrlen(*b)==len && qstrncmp(*b,s,len)==0) break;
+      }
+      if (*b==0) return FALSE;
+    }
+    else if (c==' ' || c=='*' || c=='&' || c=='.')
+    {
+      p++;
+    }
+    else
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+static bool isScopeIndependentList(const ArgumentList *al)
+{
+  if (!isBuiltinType(al->trailingReturnType)) return FALSE;
+  ArgumentListIterator ali(*al);
+  const Argument *a;
+  for (;(a=ali.current());++ali)
+  {
+    if (!isBuiltinType(a->type)) return FALSE;
+  }
+  return TRUE;
+}
+
+ArgumentList *ArgumentList::pooledCopy() const
+{
+  ArgumentListPool *pool = argumentListPool();
+  QMutexLocker locker(&pool->mutex);
+  pool->numRequests++;
+  if (m_pooled)
+  {
+    pool->numShared++;
+    return const_cast<ArgumentList*>(this);
+  }
+  QCString key = poolKey(this);
+  ArgumentList *al = pool->lists.find(key);
+  if (al)
+  {
+    pool->numShared++;
+  }
+  else
+  {
+    al = deepCopy();
+    al->m_pooled = TRUE;
+    al->m_scopeIndependent = isScopeIndependentList(al);
+    pool->lists.insert(key,al);
+  }
+  return al;
+}
+
+void ArgumentList::release(ArgumentList *al)
+{
+  if (al && !al->m_pooled)
+  {
+    delete al;
+  }
+}
+
+void getArgumentListPoolStats(uint &numLists,uint &numRequests,uint &numShared)
+{
+  ArgumentListPool *pool = argumentListPool();
+  QMutexLocker locker(&pool->mutex);
+  numLists    = pool->lists.count();
+  numRequests = pool->numRequests;
+  numShared   = pool->numShared;
+}
@@ -95,14 +95,45 @@ class ArgumentList : public QList<Argument>
                      volatileSpecifier(FALSE),
                      pureSpecifier(FALSE),
                      isDeleted(FALSE),
-                     refQualifier(RefQualifierNone)
+                     refQualifier(RefQualifierNone),
+                     m_pooled(FALSE),
+                     m_scopeIndependent(FALSE)
                      { setAutoDelete(TRUE); }
+    /*! Copies the argument list without sharing its pool entry */
+    ArgumentList(const ArgumentList &al) : QList<Argument>(al),
+                     constSpecifier(al.constSpecifier),
+                     volatileSpecifier(al.volatileSpecifier),
+                     pureSpecifier(al.pureSpecifier),
+                     trailingReturnType(al.trailingReturnType),
+                     isDeleted(al.isDeleted),
+                     refQualifier(al.refQualifier),
+                     m_pooled(FALSE),
+                     m_scopeIndependent(FALSE)
+                     {}
     /*! Destroys the argument list */
    ~ArgumentList() {}
     /*! Makes a deep copy of this object */
     ArgumentList *deepCopy() const;
     /*! Does any argument of this list have documentation? */
     bool hasDocumentation() const;
+    /*! Returns the shared, immutable copy of this list from the argument
+     *  list pool. Lists with the same content share a single copy.
+     *  Release the result with release() rather than deleting it.
+     */
+    ArgumentList *pooledCopy() const;
+    /*! Releases a list returned by pooledCopy(), or deletes \a al if it
+     *  is not pooled.
+     */
+    static void release(ArgumentList *al);
+    /*! Is this list owned by the argument list pool? Pooled lists are
+     *  shared and must not be modified; use deepCopy() to get a private
+     *  copy first.
+     */
+    bool isPooled() const { return m_pooled; }
+    /*! Are all argument types made of builtin types only, so that the
+     *  list means the same in every scope? Only computed for pooled lists.
+     */
+    bool isScopeIndependent() const { return m_scopeIndependent; }
     /*! Does the member modify the state of the class? default: FALSE. */
     bool constSpecifier;
     /*! Is the member volatile? default: FALSE. */
@@ -115,8 +146,18 @@ class ArgumentList : public QList<Argument>
     bool isDeleted;
     /*! C++11 ref qualifier */
     RefQualifierType refQualifier;
+
+  private:
+    bool m_pooled;
+    bool m_scopeIndependent;
 };
 
+/*! Returns the number of distinct lists in the argument list pool, the
+ *  number of times a list was requested and the number of those requests
+ *  that were served by an existing list.
+ */
+void getArgumentListPoolStats(uint &numLists,uint &numRequests,uint &numShared);
+
 typedef QListIterator<Argument> ArgumentListIterator;
 
 #endif
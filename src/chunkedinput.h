@@ -0,0 +1,36 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#ifndef CHUNKEDINPUT_H
+#define CHUNKEDINPUT_H
+
+/** @brief Abstract source of text that is produced while it is being read.
+ *
+ *  Used to chain the preprocessor, the comment converter and the language
+ *  scanner, such that each stage consumes the output of the previous stage
+ *  in chunks, instead of waiting for the complete output of a file.
+ */
+class ChunkedInput
+{
+  public:
+    virtual ~ChunkedInput() {}
+
+    /** Copies at most \a maxSize bytes of text to \a buf.
+     *  Returns the number of bytes copied, or 0 at the end of the text.
+     */
+    virtual int read(char *buf,int maxSize) = 0;
+};
+
+#endif
@@ -118,7 +118,7 @@ class ClassDefImpl : public DefinitionImpl, public ClassDef
     virtual bool isForwardDeclared() const;
     virtual bool isInterface() const;
     virtual ClassDef *categoryOf() const;
-    virtual QCString className() const;
+    virtual const QCString &className() const;
     virtual MemberList *getMemberList(MemberListType lt) const;
     virtual const QList<MemberList> &getMemberLists() const;
     virtual MemberGroupSDict *getMemberGroupSDict() const;
@@ -393,7 +393,7 @@ class ClassDefAliasImpl : public DefinitionAliasImpl, public ClassDef
     { return getCdAlias()->isInterface(); }
     virtual ClassDef *categoryOf() const
     { return getCdAlias()->categoryOf(); }
-    virtual QCString className() const
+    virtual const QCString &className() const
     { return getCdAlias()->className(); }
     virtual MemberList *getMemberList(MemberListType lt) const
     { return getCdAlias()->getMemberList(lt); }
@@ -623,6 +623,12 @@ class ClassDefImpl::IMPL
      */
     mutable QDict<ClassDef> *templateInstances;
 
+    /*! The same template instances, with the template argument list
+     *  normalized as the key, so that argument lists that only differ in
+     *  white space share one instance.
+     */
+    mutable QDict<ClassDef> *normalizedInstances;
+
     /*! Template instances that exists of this class, as defined by variables.
      *  We do NOT want to document these individually. The key in the
      *  dictionary is the template argument list.
@@ -723,6 +729,7 @@ void ClassDefImpl::IMPL::init(const char *defFileName, const char *name,
   innerClasses = 0;
   subGrouping=Config_getBool(SUBGROUPING);
   templateInstances = 0;
+  normalizedInstances = 0;
   variableInstances = 0;
   templateMaster =0;
   templBaseClassNames = 0;
@@ -775,6 +782,7 @@ ClassDefImpl::IMPL::~IMPL()
   delete memberGroupSDict;
   delete innerClasses;
   delete templateInstances;
+  delete normalizedInstances;
   delete variableInstances;
   delete templBaseClassNames;
   delete tempArgs;
@@ -798,6 +806,7 @@ ClassDefImpl::ClassDefImpl(
   m_impl->compType = ct;
   m_impl->isJavaEnum = isJavaEnum;
   m_impl->init(defFileName,name(),compoundTypeString(),fName);
+  m_impl->className = localName(); // until a typedef hides the class name
   m_impl->memberListFileName = convertNameToFile(compoundTypeString()+name()+"-members");
   m_impl->collabFileName = convertNameToFile(m_impl->fileName+"_coll_graph");
   m_impl->inheritFileName = convertNameToFile(m_impl->fileName+"_inherit_graph");
@@ -876,6 +885,7 @@ void ClassDefImpl::insertBaseClass(ClassDef *cd,const char *n,Protection p,
   }
   m_impl->inherits->append(new BaseClassDef(cd,n,p,s,t));
   m_impl->isSimple = FALSE;
+  invalidateAccessCache();
 }
 
 // inserts a derived/sub class in the inherited-by list
@@ -3705,8 +3715,8 @@ void ClassDefImpl::mergeMembers()
                   if (srcCd==dstCd || dstCd->isBaseClass(srcCd,TRUE))
                     // member is in the same or a base class
                   {
-                    const ArgumentList *srcAl = srcMd->argumentList();
-                    const ArgumentList *dstAl = dstMd->argumentList();
+                    const ArgumentList *srcAl = argumentListForMatching(srcMd,dstMd->argumentList());
+                    const ArgumentList *dstAl = argumentListForMatching(dstMd,srcAl);
                     found=matchArguments2(
                         srcMd->getOuterScope(),srcMd->getFileDef(),srcAl,
                         dstMd->getOuterScope(),dstMd->getFileDef(),dstAl,
@@ -4277,7 +4287,7 @@ void ClassDefImpl::determineIntfUsageRelation()
       {
         // add classes found in the return type
         addUsedInterfaceClasses(md,md->typeString());
-        ArgumentList *al = md->argumentList();
+        const ArgumentList *al = md->argumentList();
         if (al) // member has arguments
         {
           // add classes found in the types of the argument list
@@ -4418,6 +4428,7 @@ void ClassDefImpl::addInnerCompound(const Definition *d)
       m_impl->innerClasses = new ClassSDict(17);
     }
     m_impl->innerClasses->inSort(d->localName(),dynamic_cast<const ClassDef *>(d));
+    invalidateAccessCache(); // followPath() may now find the class
   }
 }
 
@@ -4472,6 +4483,15 @@ Definition *ClassDefImpl::findInnerCompound(const char *name) const
 //  return "";
 //}
 
+static uint g_numTemplateInstances;
+static uint g_numSharedTemplateInstances;
+
+void getTemplateInstanceStats(uint &created,uint &shared)
+{
+  created = g_numTemplateInstances;
+  shared  = g_numSharedTemplateInstances;
+}
+
 ClassDef *ClassDefImpl::insertTemplateInstance(const QCString &fileName,
     int startLine, int startColumn, const QCString &templSpec,bool &freshInstance) const
 {
@@ -4479,10 +4499,18 @@ ClassDef *ClassDefImpl::insertTemplateInstance(const QCString &fileName,
   if (m_impl->templateInstances==0)
   {
     m_impl->templateInstances = new QDict<ClassDef>(17);
+    m_impl->normalizedInstances = new QDict<ClassDef>(17);
   }
   ClassDef *templateClass=m_impl->templateInstances->find(templSpec);
   if (templateClass==0)
   {
+    QCString normalizedSpec = removeRedundantWhiteSpace(templSpec);
+    templateClass=m_impl->normalizedInstances->find(normalizedSpec);
+    if (templateClass) // same arguments, written differently
+    {
+      g_numSharedTemplateInstances++;
+      return templateClass;
+    }
     Debug::print(Debug::Classes,0,"      New template instance class '%s''%s'\n",qPrint(name()),qPrint(templSpec));
     QCString tcname = removeRedundantWhiteSpace(localName()+templSpec);
     templateClass = new ClassDefImpl(
@@ -4491,6 +4519,8 @@ ClassDef *ClassDefImpl::insertTemplateInstance(const QCString &fileName,
     templateClass->setOuterScope(getOuterScope());
     templateClass->setHidden(isHidden());
     m_impl->templateInstances->insert(templSpec,templateClass);
+    m_impl->normalizedInstances->insert(normalizedSpec,templateClass);
+    g_numTemplateInstances++;
     freshInstance=TRUE;
   }
   return templateClass;
@@ -4684,16 +4714,9 @@ QCString ClassDefImpl::qualifiedNameWithTemplateParameters(
   return scName;
 }
 
-QCString ClassDefImpl::className() const
+const QCString &ClassDefImpl::className() const
 {
-  if (m_impl->className.isEmpty())
-  {
-    return localName();
-  }
-  else
-  {
-    return m_impl->className;
-  }
+  return m_impl->className;
 };
 
 void ClassDefImpl::setClassName(const char *name)
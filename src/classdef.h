@@ -271,7 +271,7 @@ class ClassDef : virtual public Definition
     /** Returns the name of the class including outer classes, but not
      *  including namespaces.
      */
-    virtual QCString className() const = 0;
+    virtual const QCString &className() const = 0;
 
     /** Returns the members in the list identified by \a lt */
     virtual MemberList *getMemberList(MemberListType lt) const = 0;
@@ -423,6 +423,11 @@ ClassDef *createClassDef(
 
 ClassDef *createClassDefAlias(const Definition *newScope,const ClassDef *cd);
 
+/** Returns the number of template instances created and the number of
+ *  times an existing instance was used for an equivalent argument list.
+ */
+void getTemplateInstanceStats(uint &created,uint &shared);
+
 
 //------------------------------------------------------------------------
 
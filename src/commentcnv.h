@@ -18,10 +18,29 @@
 #ifndef _COMMENTCNV_H
 #define _COMMENTCNV_H
 
+#include "chunkedinput.h"
+
 class BufStr;
 
 extern void convertCppComments(BufStr *inBuf,BufStr *outBuf,
                                const char *fileName);
 
+/** @brief Converts the comments of a file while its output is being read.
+ *
+ *  Does the same as convertCppComments() for text that is read from
+ *  \a input in chunks. Cannot be used for Fortran, as the detection of
+ *  fixed form code needs the complete input.
+ */
+class CommentConverterStream : public ChunkedInput
+{
+  public:
+    CommentConverterStream(ChunkedInput *input,const char *fileName);
+   ~CommentConverterStream();
+    int read(char *buf,int maxSize);
+  private:
+    struct Private;
+    Private *p;
+};
+
 #endif
 
@@ -304,7 +304,8 @@ bool CondParser::evalOperator(int opId, bool lhs, bool rhs)
  */
 bool CondParser::evalVariable(const char *varName)
 {
-  if (Config_getList(ENABLED_SECTIONS).find(varName)==-1) return FALSE;
+  // contains() does not move the current item of the shared list, unlike find()
+  if (Config_getList(ENABLED_SECTIONS).contains(varName)==0) return FALSE;
   return TRUE;
 }
 
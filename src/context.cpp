@@ -54,6 +54,7 @@
 #include "groupdef.h"
 #include "searchindex.h"
 #include "resourcemgr.h"
+#include "symbolmap.h"
 
 // TODO: pass the current file to Dot*::writeGraph, so the user can put dot graphs in other
 //       files as well
@@ -4785,10 +4786,11 @@ class MemberContext::Private : public DefinitionContext<MemberContext::Private>
       Cachable &cache = getCache();
       if (!cache.paramDocs)
       {
-        if (m_memberDef->argumentList() && m_memberDef->argumentList()->hasDocumentation())
+        const ArgumentList *defArgList = m_memberDef->argumentList();
+        if (defArgList && defArgList->hasDocumentation())
         {
           QCString paramDocs;
-          ArgumentListIterator ali(*m_memberDef->argumentList());
+          ArgumentListIterator ali(*defArgList);
           Argument *a;
           // convert the parameter documentation into a list of @param commands
           for (ali.toFirst();(a=ali.current());++ali)
@@ -10369,7 +10371,7 @@ void generateOutputViaTemplate()
       }
 
       // clear all cached data in Definition objects.
-      QDictIterator<DefinitionIntf> di(*Doxygen::symbolMap);
+      SymbolMap::Iterator di(*Doxygen::symbolMap);
       const DefinitionIntf *intf;
       for (;(intf=di.current());++di)
       {
@@ -17,6 +17,7 @@
 
 #include <ctype.h>
 #include <qregexp.h>
+#include <qvector.h>
 #include "md5.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -24,6 +25,7 @@
 #include "config.h"
 #include "definitionimpl.h"
 #include "doxygen.h"
+#include "symbolmap.h"
 #include "language.h"
 #include "message.h"
 #include "portable.h"
@@ -89,7 +91,7 @@ class DefinitionImpl::IMPL
 
     QCString name;
     bool isSymbol;
-    QCString symbolName;
+    int symbolAtom; // index of the symbol name in Doxygen::symbolMap, or -1
     int defLine;
     int defColumn;
     Cookie *cookie;
@@ -99,7 +101,7 @@ DefinitionImpl::IMPL::IMPL()
   : sectionDict(0), sourceRefByDict(0), sourceRefsDict(0),
     xrefListItems(0), partOfGroups(0),
     details(0), inbodyDocs(0), brief(0), body(0), hidden(FALSE), isArtificial(FALSE),
-    outerScope(0), lang(SrcLangExt_Unknown)
+    outerScope(0), lang(SrcLangExt_Unknown), symbolAtom(-1)
 {
 }
 
@@ -166,26 +168,58 @@ void DefinitionImpl::setDefFile(const QCString &df,int defLine,int defCol)
 
 //-----------------------------------------------------------------------------------------
 
-static bool matchExcludedSymbols(const char *name)
+/** A pattern of EXCLUDE_SYMBOLS, split up and compiled once */
+struct ExcludedSymbolPattern
 {
-  static QStrList &exclSyms = Config_getList(EXCLUDE_SYMBOLS);
-  if (exclSyms.count()==0) return FALSE; // nothing specified
-  const char *pat = exclSyms.first();
-  QCString symName = name;
-  while (pat)
+  ExcludedSymbolPattern(const char *pat) : pattern(pat), forceStart(FALSE), forceEnd(FALSE), re(0)
   {
-    QCString pattern = pat;
-    bool forceStart=FALSE;
-    bool forceEnd=FALSE;
     if (pattern.at(0)=='^') 
       pattern=pattern.mid(1),forceStart=TRUE;
     if (pattern.at(pattern.length()-1)=='$') 
       pattern=pattern.left(pattern.length()-1),forceEnd=TRUE;
     if (pattern.find('*')!=-1) // wildcard mode
     {
-      QRegExp re(substitute(pattern,"*",".*"),TRUE);
+      re = new QRegExp(substitute(pattern,"*",".*"),TRUE);
+    }
+  }
+ ~ExcludedSymbolPattern() { delete re; }
+  QCString pattern;
+  bool forceStart;
+  bool forceEnd;
+  QRegExp *re;
+};
+
+static QVector<ExcludedSymbolPattern> *createExcludedSymbolPatterns()
+{
+  QStrList &exclSyms = Config_getList(EXCLUDE_SYMBOLS);
+  QVector<ExcludedSymbolPattern> *patterns = new QVector<ExcludedSymbolPattern>(exclSyms.count());
+  patterns->setAutoDelete(TRUE);
+  QStrListIterator it(exclSyms);
+  const char *pat;
+  uint i=0;
+  for (;(pat=it.current());++it)
+  {
+    patterns->insert(i++,new ExcludedSymbolPattern(pat));
+  }
+  return patterns;
+}
+
+static bool matchExcludedSymbols(const char *name)
+{
+  static QVector<ExcludedSymbolPattern> *exclSyms = createExcludedSymbolPatterns();
+  if (exclSyms->size()==0) return FALSE; // nothing specified
+  QCString symName = name;
+  uint ei;
+  for (ei=0;ei<exclSyms->size();ei++)
+  {
+    const ExcludedSymbolPattern *esp = exclSyms->at(ei);
+    const QCString &pattern = esp->pattern;
+    bool forceStart=esp->forceStart;
+    bool forceEnd=esp->forceEnd;
+    if (esp->re) // wildcard mode
+    {
       int i,pl;
-      i = re.match(symName,0,&pl);
+      i = esp->re->match(symName,0,&pl);
       //printf("  %d = re.match(%s) pattern=%s\n",i,symName.data(),pattern.data());
       if (i!=-1) // wildcard match
       {
@@ -217,7 +251,6 @@ static bool matchExcludedSymbols(const char *name)
         }
       }
     }
-    pat = exclSyms.next();
   }
   //printf("--> name=%s: no match\n",name);
   return FALSE;
@@ -232,71 +265,19 @@ static void addToMap(const char *name,Definition *d)
   if (!symbolName.isEmpty()) 
   {
     //printf("******* adding symbol '%s' (%p)\n",symbolName.data(),d);
-    DefinitionIntf *di=Doxygen::symbolMap->find(symbolName);
-    //printf("  addToMap(%p): looking for symbol %s: %p\n",d,symbolName.data(),di);
-    if (di==0) // new Symbol
-    {
-      //printf("  new symbol!\n");
-      Doxygen::symbolMap->insert(symbolName,d);
-    }
-    else // existing symbol
-    {
-      //printf("  existing symbol: ");
-      if (di->definitionType()==DefinitionIntf::TypeSymbolList) // already multiple symbols
-      {
-        //printf("adding to exiting list\n");
-        DefinitionList *dl = (DefinitionList*)di;
-        dl->append(d);
-      }
-      else // going from one to two symbols
-      {
-        Doxygen::symbolMap->take(symbolName);
-        DefinitionList *dl = new DefinitionList;
-        //printf("replacing symbol by list %p with elements %p and %p\n",dl,di,d);
-        dl->append((Definition*)di);
-        dl->append(d);
-        Doxygen::symbolMap->insert(symbolName,dl);
-      }
-    }
-
-    // auto resize if needed
-    static int sizeIndex=9;
-    if (Doxygen::symbolMap->size()>SDict_primes[sizeIndex])
-    {
-      Doxygen::symbolMap->resize(SDict_primes[++sizeIndex]);
-    }
-
-    d->_setSymbolName(symbolName);
+    int atom = Doxygen::symbolMap->atom(symbolName);
+    Doxygen::symbolMap->add(atom,d);
+    d->_setSymbolAtom(atom);
   }
 }
 
 static void removeFromMap(Definition *d)
 {
-  QCString symbolName = d->_symbolName();
-  if (!symbolName.isEmpty()) 
+  int atom = d->_symbolAtom();
+  if (atom!=-1) 
   {
-    //printf("******* removing symbol '%s' (%p)\n",symbolName.data(),d);
-    DefinitionIntf *di=Doxygen::symbolMap->find(symbolName);
-    if (di)
-    {
-      if (di!=d) // symbolName not unique
-      {
-        //printf("  removing from list: %p!\n",di);
-        DefinitionList *dl = (DefinitionList*)di;
-        bool b = dl->removeRef(d);
-        ASSERT(b==TRUE);
-        if (dl->isEmpty())
-        {
-          Doxygen::symbolMap->take(symbolName);
-          delete dl;
-        }
-      }
-      else // symbolName unique
-      {
-        //printf("  removing symbol %p\n",di);
-        Doxygen::symbolMap->take(symbolName);
-      }
-    }
+    //printf("******* removing symbol '%s' (%p)\n",Doxygen::symbolMap->atomName(atom),d);
+    Doxygen::symbolMap->remove(atom,d);
   }
 }
 
@@ -397,6 +378,7 @@ DefinitionImpl::DefinitionImpl(const DefinitionImpl &d)
 
 DefinitionImpl::~DefinitionImpl()
 {
+  invalidateAccessCache(); // results may refer to this definition
   if (m_impl->isSymbol)
   {
     removeFromMap(this);
@@ -1602,6 +1584,7 @@ void DefinitionImpl::setOuterScope(Definition *d)
   {
     m_impl->qualifiedName.resize(0); // flush cached scope name
     m_impl->outerScope = d;
+    invalidateAccessCache();
   }
   m_impl->hidden = m_impl->hidden || d->isHidden();
 }
@@ -1943,7 +1926,7 @@ SectionDict * DefinitionImpl::getSectionDict() const
 
 QCString DefinitionImpl::symbolName() const 
 { 
-  return m_impl->symbolName; 
+  return Doxygen::symbolMap->atomName(m_impl->symbolAtom);
 }
 
 //----------------------
@@ -2198,14 +2181,14 @@ void DefinitionImpl::setLanguage(SrcLangExt lang)
 }
 
 
-void DefinitionImpl::_setSymbolName(const QCString &name) 
+void DefinitionImpl::_setSymbolAtom(int atom) 
 { 
-  m_impl->symbolName=name; 
+  m_impl->symbolAtom=atom; 
 }
 
-QCString DefinitionImpl::_symbolName() const
+int DefinitionImpl::_symbolAtom() const
 {
-  return m_impl->symbolName;
+  return m_impl->symbolAtom;
 }
 
 bool DefinitionImpl::hasBriefDescription() const
@@ -2236,7 +2219,7 @@ QCString DefinitionImpl::externalReference(const QCString &relPath) const
   return relPath;
 }
 
-QCString DefinitionImpl::name() const
+const QCString &DefinitionImpl::name() const
 {
   return m_impl->name;
 }
@@ -2273,7 +2256,7 @@ void DefinitionImpl::writeSummaryLinks(OutputList &) const
 //---------------------------------------------------------------------------------
 
 DefinitionAliasImpl::DefinitionAliasImpl(const Definition *scope,const Definition *alias)
-      : m_scope(scope), m_def(alias), m_cookie(0) 
+      : m_scope(scope), m_def(alias), m_cookie(0), m_symbolAtom(-1)
 {
   //printf("%s::addToMap(%s)\n",qPrint(name()),qPrint(alias->name()));
   addToMap(alias->name(),this);
@@ -109,7 +109,7 @@ class Definition : public DefinitionIntf
     virtual bool isAlias() const = 0;
 
     /*! Returns the name of the definition */
-    virtual QCString name() const = 0;
+    virtual const QCString &name() const = 0;
 
     /*! Returns the name of the definition as it appears in the output */
     virtual QCString displayName(bool includeScope=TRUE) const = 0;
@@ -360,8 +360,8 @@ class Definition : public DefinitionIntf
     //-----------------------------------------------------------------------------------
     // --- symbol name ----
     //-----------------------------------------------------------------------------------
-    virtual void _setSymbolName(const QCString &name) = 0;
-    virtual QCString _symbolName() const = 0;
+    virtual void _setSymbolAtom(int atom) = 0;
+    virtual int _symbolAtom() const = 0;
 };
 
 /** A list of Definition objects. */
@@ -31,7 +31,7 @@ class DefinitionImpl : virtual public Definition
     virtual ~DefinitionImpl();
 
     virtual bool isAlias() const { return FALSE; }
-    virtual QCString name() const;
+    virtual const QCString &name() const;
     virtual QCString localName() const;
     virtual QCString qualifiedName() const;
     virtual QCString symbolName() const;
@@ -117,8 +117,8 @@ class DefinitionImpl : virtual public Definition
     DefinitionImpl(const DefinitionImpl &d);
 
   private: 
-    virtual void _setSymbolName(const QCString &name);
-    virtual QCString _symbolName() const ;
+    virtual void _setSymbolAtom(int atom);
+    virtual int _symbolAtom() const ;
 
     int  _getXRefListId(const char *listName) const;
     void _writeSourceRefList(OutputList &ol,const char *scopeName,
@@ -140,7 +140,7 @@ class DefinitionAliasImpl : virtual public Definition
     virtual ~DefinitionAliasImpl();
 
     virtual bool isAlias() const { return TRUE; }
-    virtual QCString name() const
+    virtual const QCString &name() const
     { return m_def->name(); }
     virtual QCString localName() const
     { return m_def->localName(); }
@@ -272,12 +272,12 @@ class DefinitionAliasImpl : virtual public Definition
     const Definition *getScope() const { return m_scope; }
 
   private:
-    virtual void _setSymbolName(const QCString &name) { m_symbolName = name; }
-    virtual QCString _symbolName() const { return m_symbolName; }
+    virtual void _setSymbolAtom(int atom) { m_symbolAtom = atom; }
+    virtual int _symbolAtom() const { return m_symbolAtom; }
     const Definition *m_scope;
     const Definition *m_def;
     mutable Cookie *m_cookie;
-    QCString m_symbolName;
+    int m_symbolAtom;
 };
 
 
@@ -3,6 +3,7 @@
 #include "entry.h"
 #include "message.h"
 #include "docgroup.h"
+#include "parseorder.h"
 
 
 void DocGroup::enterFile(const char *fileName,int)
@@ -106,6 +107,7 @@ void DocGroup::open(Entry *e,const char *,int, bool implicit)
     {
       static int curGroupId=0;
 
+      ParseOrder::waitForTurn();
       MemberGroupInfo *info = new MemberGroupInfo;
       info->header = m_memberGroupHeader.stripWhiteSpace();
       info->compoundName = m_compoundName;
@@ -136,6 +138,7 @@ void DocGroup::close(Entry *e,const char *fileName,int line,bool foundInline,boo
   //    e->name.data(),e->section,fileName,line,m_autoGroupStack.count());
   if (m_memberGroupId!=DOX_NOGROUP) // end of member group
   {
+    ParseOrder::waitForTurn();
     MemberGroupInfo *info=Doxygen::memGrpInfoDict.find(m_memberGroupId);
     if (info) // known group
     {
@@ -186,6 +189,7 @@ void DocGroup::addDocs(Entry *e)
       m_memberGroupDocs+="\n\n";
     }
     m_memberGroupDocs+=e->doc;
+    ParseOrder::waitForTurn();
     MemberGroupInfo *info=Doxygen::memGrpInfoDict.find(m_memberGroupId);
     if (info) 
     {
@@ -32,10 +32,17 @@
 #include <errno.h>
 #include <qptrdict.h>
 #include <qtextstream.h>
+#include <qthread.h>
+#include <qmutex.h>
+#include <qwaitcondition.h>
+#include <qqueue.h>
+#include <qasciidict.h>
+#include <qvector.h>
 
 #include "version.h"
 #include "doxygen.h"
 #include "scanner.h"
+#include "parseorder.h"
 #include "entry.h"
 #include "index.h"
 #include "message.h"
@@ -81,6 +88,9 @@
 #include "code.h"
 #include "objcache.h"
 #include "portable.h"
+#include "patternmatcher.h"
+#include "lookupcache.h"
+#include "symbolmap.h"
 #include "vhdljjparser.h"
 #include "vhdldocgen.h"
 #include "eclipsehelp.h"
@@ -102,6 +112,7 @@
 #include "fileparser.h"
 #include "emoji.h"
 #include "plantuml.h"
+#include "entrycache.h"
 
 // provided by the generated file resources.cpp
 extern void initResources();
@@ -153,11 +164,11 @@ QDict<RefList>  *Doxygen::xrefLists = new QDict<RefList>; // dictionary of cross
 bool             Doxygen::parseSourcesNeeded = FALSE;
 QTime            Doxygen::runningTime;
 SearchIndexIntf *Doxygen::searchIndex=0;
-QDict<DefinitionIntf> *Doxygen::symbolMap = 0;
+SymbolMap *Doxygen::symbolMap = 0;
 QDict<Definition> *Doxygen::clangUsrMap = 0;
 bool             Doxygen::outputToWizard=FALSE;
 QDict<int> *     Doxygen::htmlDirMap = 0;
-QCache<LookupInfo> *Doxygen::lookupCache;
+LookupCache *Doxygen::lookupCache;
 DirSDict        *Doxygen::directories;
 SDict<DirRelation> Doxygen::dirRelations(257);
 ParserManager   *Doxygen::parserManager = 0;
@@ -173,9 +184,9 @@ int              Doxygen::subpageNestingLevel = 0;
 bool             Doxygen::userComments = FALSE;
 QCString         Doxygen::spaces;
 bool             Doxygen::generatingXmlOutput = FALSE;
-bool             Doxygen::markdownSupport = TRUE;
+thread_local bool Doxygen::markdownSupport = Config_getBool(MARKDOWN_SUPPORT);
 GenericsSDict   *Doxygen::genericsDict;
-DocGroup         Doxygen::docGroup;
+thread_local DocGroup Doxygen::docGroup;
 
 // locally accessible globals
 static QDict<Entry>     g_classEntries(1009);
@@ -186,6 +197,7 @@ static QDict<FileDef>   g_usingDeclarations(1009); // used classes
 static bool             g_successfulRun = FALSE;
 static bool             g_dumpSymbolMap = FALSE;
 static bool             g_useOutputTemplate = FALSE;
+static EntryCache      *g_entryCache = 0;          // cache of parsed Entry trees
 
 void clearAll()
 {
@@ -225,6 +237,11 @@ class Statistics
       stats.append(entry);
       time.restart();
     }
+    //! records that the current step ran on \a numThreads threads
+    void setThreads(int numThreads)
+    {
+      stats.getLast()->threads=numThreads;
+    }
     void end()
     {
       stats.getLast()->elapsed=((double)time.elapsed())/1000.0;
@@ -242,7 +259,14 @@ class Statistics
       stat *s;
       for ( sli.toFirst(); (s=sli.current()); ++sli )
       {
-        msg("Spent %.3f seconds in %s",s->elapsed,s->name);
+        if (s->threads>1)
+        {
+          msg("Spent %.3f seconds using %d threads in %s",s->elapsed,s->threads,s->name);
+        }
+        else
+        {
+          msg("Spent %.3f seconds in %s",s->elapsed,s->name);
+        }
       }
       if (restore) Debug::setFlag("time");
     }
@@ -251,8 +275,9 @@ class Statistics
     {
       const char *name;
       double elapsed;
-      stat() : name(NULL),elapsed(0) {}
-      stat(const char *n, double el) : name(n),elapsed(el) {}
+      int threads;
+      stat() : name(NULL),elapsed(0),threads(1) {}
+      stat(const char *n, double el) : name(n),elapsed(el),threads(1) {}
     };
     QList<stat> stats;
     QTime       time;
@@ -3619,7 +3644,7 @@ static void buildFunctionList(Entry *root)
               if (rnd) rnsName = rnd->name().copy();
               //printf("matching arguments for %s%s %s%s\n",
               //    md->name().data(),md->argsString(),rname.data(),argListToString(root->argList).data());
-              ArgumentList *mdAl = md->argumentList();
+              const ArgumentList *mdAl = argumentListForMatching(md,root->argList);
               const ArgumentList *mdTempl = md->templateArguments();
 
               // in case of template functions, we need to check if the
@@ -3676,7 +3701,7 @@ static void buildFunctionList(Entry *root)
                 if (found)
                 {
                   // merge argument lists
-                  mergeArguments(mdAl,root->argList,!root->doc.isEmpty());
+                  mergeArguments(md->writableArgumentList(),root->argList,!root->doc.isEmpty());
                   // merge documentation
                   if (md->documentation().isEmpty() && !root->doc.isEmpty())
                   {
@@ -3942,16 +3967,16 @@ static void findFriends()
           //    mmd->isRelated(),mmd->isFriend(),mmd->isFunction());
           if ((cmmd->isFriend() || (cmmd->isRelated() && cmmd->isFunction())) &&
               !fmd->isAlias() && !mmd->isAlias() &&
-              matchArguments2(cmmd->getOuterScope(), cmmd->getFileDef(), cmmd->argumentList(),
-                              cfmd->getOuterScope(), cfmd->getFileDef(), cfmd->argumentList(),
+              matchArguments2(cmmd->getOuterScope(), cmmd->getFileDef(), argumentListForMatching(mmd,fmd->argumentList()),
+                              cfmd->getOuterScope(), cfmd->getFileDef(), argumentListForMatching(fmd,mmd->argumentList()),
                               TRUE
                              )
 
              ) // if the member is related and the arguments match then the
                // function is actually a friend.
           {
-            ArgumentList *mmdAl = mmd->argumentList();
-            ArgumentList *fmdAl = fmd->argumentList();
+            ArgumentList *mmdAl = mmd->writableArgumentList();
+            ArgumentList *fmdAl = fmd->writableArgumentList();
             mergeArguments(mmdAl,fmdAl);
             if (!fmd->documentation().isEmpty())
             {
@@ -4067,8 +4092,8 @@ static void transferFunctionReferences()
     }
     if (mdef && mdec)
     {
-      ArgumentList *mdefAl = mdef->argumentList();
-      ArgumentList *mdecAl = mdec->argumentList();
+      const ArgumentList *mdefAl = argumentListForMatching(mdef,mdec->argumentList());
+      const ArgumentList *mdecAl = argumentListForMatching(mdec,mdefAl);
       if (
           matchArguments2(mdef->getOuterScope(),mdef->getFileDef(),mdefAl,
                           mdec->getOuterScope(),mdec->getFileDef(),mdecAl,
@@ -4161,8 +4186,8 @@ static void transferRelatedFunctionDocumentation()
           //printf("  Member found: related='%d'\n",rmd->isRelated());
           if ((rmd->isRelated() || rmd->isForeign()) && // related function
               !md->isAlias() && !rmd->isAlias() &&
-              matchArguments2( md->getOuterScope(), md->getFileDef(), md->argumentList(),
-                              rmd->getOuterScope(),rmd->getFileDef(),rmd->argumentList(),
+              matchArguments2( md->getOuterScope(), md->getFileDef(), argumentListForMatching(md,rmd->argumentList()),
+                              rmd->getOuterScope(),rmd->getFileDef(),argumentListForMatching(rmd,md->argumentList()),
                               TRUE
                              )
              )
@@ -5371,23 +5396,23 @@ static void addMemberDocs(Entry *root,
   // TODO determine scope based on root not md
   Definition *rscope = md->getOuterScope();
 
-  ArgumentList *mdAl = md->argumentList();
   if (al)
   {
     //printf("merging arguments (1) docs=%d\n",root->doc.isEmpty());
-    mergeArguments(mdAl,al,!root->doc.isEmpty());
+    mergeArguments(md->writableArgumentList(),al,!root->doc.isEmpty());
   }
   else
   {
     if (
-          matchArguments2( md->getOuterScope(), md->getFileDef(), mdAl,
+          matchArguments2( md->getOuterScope(), md->getFileDef(),
+                           argumentListForMatching(md,root->argList),
                            rscope,rfd,root->argList,
                            TRUE
                          )
        )
     {
       //printf("merging arguments (2)\n");
-      mergeArguments(mdAl,root->argList,!root->doc.isEmpty());
+      mergeArguments(md->writableArgumentList(),root->argList,!root->doc.isEmpty());
     }
   }
   if (over_load)  // the \overload keyword was used
@@ -5557,7 +5582,7 @@ static bool findGlobalMember(Entry *root,
         NamespaceDef *rnd = 0;
         if (!namespaceName.isEmpty()) rnd = Doxygen::namespaceSDict->find(namespaceName);
 
-        const ArgumentList *mdAl = const_cast<const MemberDef *>(md)->argumentList();
+        const ArgumentList *mdAl = argumentListForMatching(md,root->argList);
         bool matching=
           (mdAl==0 && root->argList->count()==0) ||
           md->isVariable() || md->isTypedef() || /* in case of function pointers */
@@ -5765,7 +5790,7 @@ static QCString substituteTemplatesInString(
 static void substituteTemplatesInArgList(
                   const QList<ArgumentList> &srcTempArgLists,
                   const QList<ArgumentList> &dstTempArgLists,
-                  ArgumentList *src,
+                  const ArgumentList *src,
                   ArgumentList *dst,
                   ArgumentList *funcTempArgs = 0
                  )
@@ -6201,12 +6226,13 @@ static void findMember(Entry *root,
 
               // do we replace the decl argument lists with the def argument lists?
               bool substDone=FALSE;
-              ArgumentList *argList=0;
+              const ArgumentList *argList=0;
+              ArgumentList *substArgList=0;
 
               /* substitute the occurrences of class template names in the
                * argument list before matching
                */
-              ArgumentList *mdAl = md->argumentList();
+              const ArgumentList *mdAl = argumentListForMatching(md,root->argList);
               if (declTemplArgs.count()>0 && defTemplArgs &&
                   declTemplArgs.count()==defTemplArgs->count() &&
                   mdAl
@@ -6217,9 +6243,10 @@ static void findMember(Entry *root,
                  * we must substitute the template names of the class by that
                  * of the function definition before matching.
                  */
-                argList = new ArgumentList;
+                substArgList = new ArgumentList;
                 substituteTemplatesInArgList(declTemplArgs,*defTemplArgs,
-                    mdAl,argList);
+                    mdAl,substArgList);
+                argList = substArgList;
 
                 substDone=TRUE;
               }
@@ -6294,7 +6321,7 @@ static void findMember(Entry *root,
                 if (matching) // replace member's argument list
                 {
                   md->setDefinitionTemplateParameterLists(root->tArgLists);
-                  md->setArgumentList(argList); // new owner of the list => no delete
+                  md->setArgumentList(substArgList); // new owner of the list => no delete
                 }
                 else // no match
                 {
@@ -6312,7 +6339,7 @@ static void findMember(Entry *root,
                     addMethodToClass(root,cd,md->name(),isFriend);
                     return;
                   }
-                  delete argList;
+                  delete substArgList;
                 }
               }
               if (matching)
@@ -6635,7 +6662,7 @@ static void findMember(Entry *root,
           MemberDef *rmd;
           while ((rmd=mni.current()) && newMember) // see if we got another member with matching arguments
           {
-            ArgumentList *rmdAl = rmd->argumentList();
+            const ArgumentList *rmdAl = argumentListForMatching(rmd,root->argList);
 
             newMember=
               className!=rmd->getOuterScope()->name() ||
@@ -7772,8 +7799,8 @@ static void computeMemberRelations()
               mcd->isBaseClass(bmcd,TRUE))
           {
             //printf("  derived scope\n");
-            ArgumentList *bmdAl = bmd->argumentList();
-            ArgumentList *mdAl =  md->argumentList();
+            const ArgumentList *bmdAl = argumentListForMatching(bmd,md->argumentList());
+            const ArgumentList *mdAl =  argumentListForMatching(md,bmdAl);
             //printf(" Base argList='%s'\n Super argList='%s'\n",
             //        argListToString(bmdAl.pointer()).data(),
             //        argListToString(mdAl.pointer()).data()
@@ -7817,8 +7844,12 @@ static void computeMemberRelations()
 
 //----------------------------------------------------------------------------
 
+static uint g_numInstancesWithoutMembers;
+static uint g_numInstanceMembersSkipped;
+
 static void createTemplateInstanceMembers()
 {
+  static bool lazyInstances = Config_getBool(LAZY_TEMPLATE_INSTANCES);
   ClassSDict::Iterator cli(*Doxygen::classSDict);
   ClassDef *cd;
   // for each class
@@ -7833,7 +7864,22 @@ static void createTemplateInstanceMembers()
       // for each instance of the template
       for (qdi.toFirst();(tcd=qdi.current());++qdi)
       {
-        tcd->addMembersToTemplateInstance(cd,qdi.currentKey());
+        // the members of an instance are only used by the classes that
+        // derive from it, instances do not get pages of their own.
+        if (lazyInstances && tcd->subClasses()==0)
+        {
+          g_numInstancesWithoutMembers++;
+          if (cd->memberNameInfoSDict())
+          {
+            MemberNameInfoSDict::Iterator mnili(*cd->memberNameInfoSDict());
+            MemberNameInfo *mni;
+            for (;(mni=mnili.current());++mnili) g_numInstanceMembersSkipped+=mni->count();
+          }
+        }
+        else
+        {
+          tcd->addMembersToTemplateInstance(cd,qdi.currentKey());
+        }
       }
     }
   }
@@ -8138,15 +8184,123 @@ static void addSourceReferences()
 
 //----------------------------------------------------------------------------
 
-static void sortMemberLists()
+typedef void ClassPassFunc(ClassDef *cd);
+
+/** Queue of classes that are processed by ClassPassThread objects.
+ *  The classes are copied to an array up front, since iterating
+ *  over the class dictionary is not safe from multiple threads.
+ */
+class ClassPassQueue
 {
-  // sort class member lists
-  ClassSDict::Iterator cli(*Doxygen::classSDict);
-  ClassDef *cd=0;
-  for (cli.toFirst();(cd=cli.current());++cli)
+  public:
+    ClassPassQueue(ClassPassFunc *func)
+      : m_func(func), m_classes(Doxygen::classSDict->count()), m_next(0)
+    {
+      ClassSDict::Iterator cli(*Doxygen::classSDict);
+      ClassDef *cd;
+      uint i=0;
+      for (cli.toFirst();(cd=cli.current());++cli)
+      {
+        m_classes.insert(i++,cd);
+      }
+    }
+    //! returns the number of classes in the next chunk starting at \a first,
+    //! or 0 if all classes have been handed out
+    uint dequeue(uint &first)
+    {
+      QMutexLocker locker(&m_mutex);
+      first = m_next;
+      uint n = QMIN(m_classes.size()-m_next,64);
+      m_next+=n;
+      return n;
+    }
+    void process(uint first,uint n)
+    {
+      uint i;
+      for (i=first;i<first+n;i++)
+      {
+        m_func(m_classes.at(i));
+      }
+    }
+  private:
+    ClassPassFunc    *m_func;
+    QVector<ClassDef> m_classes;
+    QMutex            m_mutex;
+    uint              m_next;
+};
+
+/** Worker thread running a pass of the analysis phase on chunks of classes */
+class ClassPassThread : public QThread
+{
+  public:
+    ClassPassThread(ClassPassQueue *queue) : m_queue(queue) {}
+    void run()
+    {
+      uint first,n;
+      while ((n=m_queue->dequeue(first)))
+      {
+        m_queue->process(first,n);
+      }
+    }
+  private:
+    ClassPassQueue *m_queue;
+};
+
+/** Runs \a func for every class, using up to NUM_PROC_THREADS threads
+ *  including the calling one. \a func may only change the class it is
+ *  given and the members owned by that class. Returns the number of
+ *  threads that were used.
+ */
+static int forEachClass(ClassPassFunc *func)
+{
+  ClassPassQueue queue(func);
+  QList<ClassPassThread> workers;
+  workers.setAutoDelete(TRUE);
+  int numThreads = QMIN(Config_getInt(NUM_PROC_THREADS),
+                        (int)(Doxygen::classSDict->count()/64));
+  // classes can share strings, for instance with their template instances
+  if (numThreads>1) qt_multiThreaded=TRUE;
+  int i;
+  for (i=1;i<numThreads;i++)
+  {
+    ClassPassThread *thread = new ClassPassThread(&queue);
+    thread->start();
+    if (thread->isRunning())
+    {
+      workers.append(thread);
+    }
+    else // no more threads available!
+    {
+      delete thread;
+    }
+  }
+  uint first,n;
+  while ((n=queue.dequeue(first)))
   {
-    cd->sortMemberLists();
+    queue.process(first,n);
   }
+  QListIterator<ClassPassThread> it(workers);
+  ClassPassThread *thread;
+  for (;(thread=it.current());++it)
+  {
+    thread->wait();
+  }
+  qt_multiThreaded=FALSE;
+  return workers.count()+1;
+}
+
+// the comparators of the member and class lists read the names by
+// reference, so sorting does not touch the reference counts
+static void sortClassMemberLists(ClassDef *cd)
+{
+  cd->sortMemberLists();
+}
+
+//! sorts the member lists, returns the number of threads that were used
+static int sortMemberLists()
+{
+  // sort class member lists, each class only sorts its own lists
+  int numThreads = forEachClass(sortClassMemberLists);
 
   // sort namespace member lists
   NamespaceSDict::Iterator nli(*Doxygen::namespaceSDict);
@@ -8176,6 +8330,7 @@ static void sortMemberLists()
   {
     gd->sortMemberLists();
   }
+  return numThreads;
 }
 
 //----------------------------------------------------------------------------
@@ -8503,15 +8658,9 @@ static void flushCachedTemplateRelations()
   // as there can be new template instances in the inheritance path
   // to this class. Optimization: only remove those classes that
   // have inheritance instances as direct or indirect sub classes.
-  QCacheIterator<LookupInfo> ci(*Doxygen::lookupCache);
-  LookupInfo *li=0;
-  for (ci.toFirst();(li=ci.current());++ci)
-  {
-    if (li->classDef)
-    {
-      Doxygen::lookupCache->remove(ci.currentKey());
-    }
-  }
+  Doxygen::lookupCache->flushResolved();
+  invalidateCanonicalTypeCache();
+  invalidateAccessCache();
   // remove all cached typedef resolutions whose target is a
   // template class as this may now be a template instance
   MemberNameSDict::Iterator fnli(*Doxygen::functionNameSDict);
@@ -8559,15 +8708,9 @@ static void flushUnresolvedRelations()
   // class B : public A {};
   // class C : public B::I {};
   //
-  QCacheIterator<LookupInfo> ci(*Doxygen::lookupCache);
-  LookupInfo *li=0;
-  for (ci.toFirst();(li=ci.current());++ci)
-  {
-    if (li->classDef==0 && li->typeDef==0)
-    {
-      Doxygen::lookupCache->remove(ci.currentKey());
-    }
-  }
+  Doxygen::lookupCache->flushUnresolved();
+  invalidateCanonicalTypeCache();
+  invalidateAccessCache();
 
   MemberNameSDict::Iterator fnli(*Doxygen::functionNameSDict);
   MemberName *fn;
@@ -9459,6 +9602,28 @@ static void copyExtraFiles(QStrList files,const QString &filesOption,const QCStr
 
 //----------------------------------------------------------------------------
 
+static uint64 g_entryBytesBeforeRelease = 0;
+static uint64 g_peakMemoryBeforeRelease = 0;
+
+/** Deletes the entry tree below \a root and \a root itself, one file at a
+ *  time, so the arena of each file is freed as soon as its entries are gone.
+ */
+static void releaseEntryTree(Entry *root)
+{
+  uint numArenas,liveArenas;
+  uint64 peakBytes;
+  getEntryArenaStats(numArenas,liveArenas,g_entryBytesBeforeRelease,peakBytes);
+  g_peakMemoryBeforeRelease = portable_peakMemoryUsage();
+  Entry *fileRoot;
+  while ((fileRoot=root->children()->getFirst()))
+  {
+    delete root->removeSubEntry(fileRoot);
+  }
+  delete root;
+}
+
+//----------------------------------------------------------------------------
+
 static ParserInterface *getParserForFile(const char *fn)
 {
   QCString fileName=fn;
@@ -9477,15 +9642,19 @@ static ParserInterface *getParserForFile(const char *fn)
   return Doxygen::parserManager->getParser(extension);
 }
 
-static void parseFile(ParserInterface *parser,
-                      Entry *root,FileDef *fd,const char *fn,
-                      bool sameTu,QStrList &filesInSameTu)
+//! parses file \a fn and returns the Entry tree of the file
+static Entry *parseFile(ParserInterface *parser,
+                        FileDef *fd,const char *fn,
+                        bool sameTu,QStrList &filesInSameTu,
+                        const char *loadedData=0,uint loadedSize=0)
 {
 #if USE_LIBCLANG
   static bool clangAssistedParsing = Config_getBool(CLANG_ASSISTED_PARSING);
 #else
   static bool clangAssistedParsing = FALSE;
 #endif
+  // the entries of each file come from their own arena
+  EntryArenaScope arenaScope;
   QCString fileName=fn;
   QCString extension;
   int ei = fileName.findRev('.');
@@ -9499,21 +9668,77 @@ static void parseFile(ParserInterface *parser,
   }
 
   QFileInfo fi(fileName);
-  BufStr preBuf(fi.size()+4096);
 
-  if (Config_getBool(ENABLE_PREPROCESSING) &&
-      parser->needsPreprocessing(extension))
+  // if possible use the file contents directly instead of reading a copy
+  MappedInputFile fileMap;
+  if (loadedData==0 &&
+      fileMap.map(fileName,getFileFilter(fileName,FALSE),Config_getString(INPUT_ENCODING)))
+  {
+    loadedData = fileMap.data();
+    loadedSize = fileMap.size();
+  }
+
+  bool preprocess = Config_getBool(ENABLE_PREPROCESSING) &&
+                    parser->needsPreprocessing(extension);
+
+  // when the complete preprocessed and converted text is not needed, let the
+  // parser read it while the preprocessor and comment converter produce it.
+  // On a worker thread the preprocessor has its own turn, so there the text
+  // is preprocessed first to let the next file start preprocessing.
+  if (preprocess && !clangAssistedParsing && !ParseOrder::isBound() &&
+      !(g_entryCache && g_entryCache->isCacheable(fileName)) &&
+      !Debug::isFlagSet(Debug::Preprocessor) &&
+      !Debug::isFlagSet(Debug::CommentCnv) &&
+      getLanguageFromFileName(fileName)!=SrcLangExt_Fortran)
+  {
+    msg("Preprocessing %s...\n",fn);
+    BufStr inBuf(loadedData ? 0 : fi.size()+4096);
+    if (loadedData==0)
+    {
+      readInputFile(fileName,inBuf);
+      loadedData = inBuf.data();
+      loadedSize = inBuf.curPos();
+    }
+    PreprocessorStream preStream(fileName,loadedData,loadedSize);
+    CommentConverterStream convStream(&preStream,fileName);
+    Entry *fileRoot = new Entry;
+    parser->parseInputStream(fileName,convStream,fileRoot,sameTu,filesInSameTu);
+    fileRoot->setFileDef(fd);
+    return fileRoot;
+  }
+
+  // the complete text is needed, so it is collected in a buffer
+  BufStr preBuf(fi.size()+4096);
+  if (preprocess)
   {
-    BufStr inBuf(fi.size()+4096);
+    // the defines and include guards are shared by all files
+    ParseOrder::waitForTurn(ParseOrder::Preprocess);
     msg("Preprocessing %s...\n",fn);
-    readInputFile(fileName,inBuf);
-    preprocessFile(fileName,inBuf,preBuf);
+    if (loadedData) // contents mapped or already read by a worker thread
+    {
+      preprocessFile(fileName,loadedData,loadedSize,preBuf);
+    }
+    else
+    {
+      BufStr inBuf(fi.size()+4096);
+      readInputFile(fileName,inBuf);
+      preprocessFile(fileName,inBuf.data(),inBuf.curPos(),preBuf);
+    }
   }
   else // no preprocessing
   {
     msg("Reading %s...\n",fn);
-    readInputFile(fileName,preBuf);
+    if (loadedData) // contents mapped or already read by a worker thread
+    {
+      preBuf.addArray(loadedData,loadedSize);
+    }
+    else
+    {
+      readInputFile(fileName,preBuf);
+    }
   }
+  ParseOrder::finishStep(ParseOrder::Preprocess);
+  fileMap.unmap();
   if (preBuf.data() && preBuf.curPos()>0 && *(preBuf.data()+preBuf.curPos()-1)!='\n')
   {
     preBuf.addChar('\n'); // add extra newline to help parser
@@ -9531,16 +9756,191 @@ static void parseFile(ParserInterface *parser,
     fd->getAllIncludeFilesRecursively(filesInSameTu);
   }
 
+  QCString cacheKey;
+  if (g_entryCache && g_entryCache->isCacheable(fileName))
+  {
+    cacheKey = g_entryCache->key(fileName,convBuf);
+    Entry *fileRoot = g_entryCache->load(cacheKey);
+    if (fileRoot) // file did not change since the previous run
+    {
+      fileRoot->setFileDef(fd);
+      return fileRoot;
+    }
+    g_entryCache->startParse();
+  }
+
   Entry *fileRoot = new Entry;
   // use language parse to parse the file
   parser->parseInput(fileName,convBuf.data(),fileRoot,sameTu,filesInSameTu);
+  if (!cacheKey.isEmpty())
+  {
+    g_entryCache->store(cacheKey,fileRoot);
+  }
   fileRoot->setFileDef(fd);
-  root->addSubEntry(fileRoot);
+  return fileRoot;
+}
+
+//----------------------------------------------------------------------------
+
+/** An input file that is loaded and parsed by an InputFileParserThread. */
+struct ParsedInputFile
+{
+  ParsedInputFile(const char *fn,FileDef *f,ParserInterface *p,
+                  const char *filter,const char *encoding)
+    : fileName(fn), fd(f), parser(p), filterName(filter),
+      inputEncoding(encoding), fileRoot(0) {}
+  QCString         fileName;
+  FileDef         *fd;
+  ParserInterface *parser;   // 0 if the thread's own C scanner is used
+  QCString         filterName;
+  QCString         inputEncoding;
+  Entry           *fileRoot; // result, set by the thread that parsed the file
+};
+
+/** Hands out the input files to the parser threads in input order. */
+// all methods are thread safe
+class InputFileParserQueue
+{
+  public:
+    InputFileParserQueue(QList<ParsedInputFile> &files)
+      : m_files(files), m_next(0), m_order(files.count()) {}
+    //! returns the index of the next file to parse, or -1 if all files are handed out
+    int dequeue()
+    {
+      QMutexLocker locker(&m_mutex);
+      if (m_next>=(int)m_files.count()) return -1;
+      return m_next++;
+    }
+    //! returns the file at \a index, the list itself is not changed while parsing
+    ParsedInputFile *file(int index) const { return m_files.at(index); }
+    ParseOrder &order() { return m_order; }
+  private:
+    QList<ParsedInputFile> &m_files;
+    QMutex                  m_mutex;
+    int                     m_next;
+    ParseOrder              m_order;
+};
+
+/** Worker thread loading, preprocessing and parsing input files */
+class InputFileParserThread : public QThread
+{
+  public:
+    InputFileParserThread(InputFileParserQueue *queue) : m_queue(queue) {}
+    void run()
+    {
+      int index;
+      while ((index=m_queue->dequeue())!=-1)
+      {
+        ParsedInputFile *file = m_queue->file(index);
+        ParseOrder::Scope scope(m_queue->order(),index);
+        ParserInterface *parser = file->parser;
+        if (parser==0)
+        {
+          parser = &m_scanner;
+        }
+        else
+        {
+          // the other parsers keep their state in globals, so they only run
+          // once all files before this one are done
+          ParseOrder::waitForTurn(ParseOrder::Preprocess);
+          ParseOrder::waitForTurn(ParseOrder::Parse);
+        }
+        MappedInputFile map;
+        BufStr buf(0);
+        const char *data;
+        uint size;
+        if (map.map(file->fileName,file->filterName,file->inputEncoding))
+        {
+          data = map.data();
+          size = map.size();
+        }
+        else
+        {
+          loadInputFile(file->fileName,buf,file->filterName,file->inputEncoding);
+          data = buf.data();
+          size = buf.curPos();
+        }
+        QStrList filesInSameTu;
+        parser->startTranslationUnit(file->fileName);
+        file->fileRoot = parseFile(parser,file->fd,file->fileName,FALSE,filesInSameTu,data,size);
+      }
+    }
+  private:
+    InputFileParserQueue *m_queue;
+    CLanguageScanner      m_scanner;
+};
+
+//! parse the input files using \a numThreads threads
+static void parseFilesMultiThreading(Entry *root,int numThreads)
+{
+  // look up everything that needs the shared dictionaries up front
+  QList<ParsedInputFile> files;
+  files.setAutoDelete(TRUE);
+  StringListIterator it(g_inputFiles);
+  QCString *s;
+  for (;(s=it.current());++it)
+  {
+    bool ambig;
+    FileDef *fd=findFileDef(Doxygen::inputNameDict,s->data(),ambig);
+    ASSERT(fd!=0);
+    ParserInterface *parser = getParserForFile(s->data());
+    if (dynamic_cast<CLanguageScanner*>(parser))
+    {
+      parser = 0;
+    }
+    files.append(new ParsedInputFile(s->data(),fd,parser,
+          getFileFilter(s->data(),FALSE).data(),
+          Config_getString(INPUT_ENCODING).data()));
+  }
+
+  InputFileParserQueue queue(files);
+  QList<InputFileParserThread> workers;
+  workers.setAutoDelete(TRUE);
+  qt_multiThreaded=TRUE;
+  int i;
+  for (i=0;i<numThreads;i++)
+  {
+    InputFileParserThread *thread = new InputFileParserThread(&queue);
+    thread->start();
+    if (thread->isRunning())
+    {
+      workers.append(thread);
+    }
+    else // no more threads available!
+    {
+      delete thread;
+    }
+  }
+  if (workers.count()==0) // no threads available, parse the files ourselves
+  {
+    InputFileParserThread thread(&queue);
+    thread.run();
+  }
+  QListIterator<InputFileParserThread> wit(workers);
+  InputFileParserThread *thread;
+  for (;(thread=wit.current());++wit)
+  {
+    thread->wait();
+  }
+  qt_multiThreaded=FALSE;
+
+  // attach the trees in input order, as a serial run does
+  QListIterator<ParsedInputFile> fit(files);
+  ParsedInputFile *file;
+  for (;(file=fit.current());++fit)
+  {
+    root->addSubEntry(file->fileRoot);
+  }
 }
 
 //! parse the list of input files
 static void parseFiles(Entry *root)
 {
+  QCString cacheDir = Config_getString(ENTRY_CACHE_DIR);
+  if (!cacheDir.isEmpty() && Config_getBool(ENABLE_PREPROCESSING))
+  {
+    initHeaderCache(cacheDir);
+  }
 #if USE_LIBCLANG
   static bool clangAssistedParsing = Config_getBool(CLANG_ASSISTED_PARSING);
   if (clangAssistedParsing)
@@ -9567,7 +9967,7 @@ static void parseFiles(Entry *root)
         QStrList filesInSameTu;
         ParserInterface * parser = getParserForFile(s->data());
         parser->startTranslationUnit(s->data());
-        parseFile(parser,root,fd,s->data(),FALSE,filesInSameTu);
+        root->addSubEntry(parseFile(parser,fd,s->data(),FALSE,filesInSameTu));
         //printf("  got %d extra files in tu\n",filesInSameTu.count());
 
         // Now process any include files in the same translation unit
@@ -9582,7 +9982,7 @@ static void parseFiles(Entry *root)
             {
               QStrList moreFiles;
               //printf("  Processing %s in same translation unit as %s\n",incFile,s->data());
-              parseFile(parser,root,ifd,incFile,TRUE,moreFiles);
+              root->addSubEntry(parseFile(parser,ifd,incFile,TRUE,moreFiles));
               g_processedFiles.insert(incFile,(void*)0x8);
             }
           }
@@ -9603,7 +10003,7 @@ static void parseFiles(Entry *root)
         ASSERT(fd!=0);
         ParserInterface * parser = getParserForFile(s->data());
         parser->startTranslationUnit(s->data());
-        parseFile(parser,root,fd,s->data(),FALSE,filesInSameTu);
+        root->addSubEntry(parseFile(parser,fd,s->data(),FALSE,filesInSameTu));
         parser->finishTranslationUnit();
         g_processedFiles.insert(*s,(void*)0x8);
       }
@@ -9612,19 +10012,38 @@ static void parseFiles(Entry *root)
   else // normal pocessing
 #endif
   {
-    StringListIterator it(g_inputFiles);
-    QCString *s;
-    for (;(s=it.current());++it)
+    if (!cacheDir.isEmpty())
     {
-      bool ambig;
-      QStrList filesInSameTu;
-      FileDef *fd=findFileDef(Doxygen::inputNameDict,s->data(),ambig);
-      ASSERT(fd!=0);
-      ParserInterface * parser = getParserForFile(s->data());
-      parser->startTranslationUnit(s->data());
-      parseFile(parser,root,fd,s->data(),FALSE,filesInSameTu);
+      g_entryCache = new EntryCache(cacheDir);
+    }
+    if (Config_getInt(NUM_PROC_THREADS)>1 && g_inputFiles.count()>1)
+    {
+      parseFilesMultiThreading(root,Config_getInt(NUM_PROC_THREADS));
+    }
+    else
+    {
+      StringListIterator it(g_inputFiles);
+      QCString *s;
+      for (;(s=it.current());++it)
+      {
+        bool ambig;
+        QStrList filesInSameTu;
+        FileDef *fd=findFileDef(Doxygen::inputNameDict,s->data(),ambig);
+        ASSERT(fd!=0);
+        ParserInterface * parser = getParserForFile(s->data());
+        parser->startTranslationUnit(s->data());
+        root->addSubEntry(parseFile(parser,fd,s->data(),FALSE,filesInSameTu));
+      }
+    }
+    if (g_entryCache)
+    {
+      msg("Used the entry cache for %d of %d files\n",
+          g_entryCache->hits(),g_entryCache->hits()+g_entryCache->misses());
+      delete g_entryCache;
+      g_entryCache=0;
     }
   }
+  cleanUpHeaderCache();
 }
 
 // resolves a path that may include symlinks, if a recursive symlink is
@@ -9697,6 +10116,148 @@ static QCString resolveSymlink(QCString path)
 
 static QDict<void> g_pathsVisited(1009);
 
+//----------------------------------------------------------------------------
+
+/** Queue of directories that are read by DirPrefetchThread objects */
+class DirPrefetchQueue
+{
+  public:
+    DirPrefetchQueue(const char *dirName,const PatternMatcher *exclMatcher,bool followSymLinks)
+      : m_exclMatcher(exclMatcher), m_visited(1009), m_followSymLinks(followSymLinks),
+        m_busy(0), m_stopped(FALSE)
+    {
+      m_queue.setAutoDelete(TRUE);
+      m_visited.insert(dirName,(void*)0x8);
+      m_queue.enqueue(new QCString(dirName));
+    }
+    //! returns the next directory to read, or 0 if there are no more directories
+    QCString *dequeue()
+    {
+      QMutexLocker locker(&m_mutex);
+      while (!m_stopped && m_queue.isEmpty() && m_busy>0)
+      {
+        m_changed.wait(&m_mutex);
+      }
+      if (m_stopped || m_queue.isEmpty())
+      {
+        m_changed.wakeAll();
+        return 0;
+      }
+      m_busy++;
+      return m_queue.dequeue();
+    }
+    //! marks a directory returned by dequeue() as read, with sub directories \a subDirs
+    void markRead(QStrList &subDirs)
+    {
+      QMutexLocker locker(&m_mutex);
+      const char *s;
+      for (s=subDirs.first();s;s=subDirs.next())
+      {
+        if (m_visited.find(s)==0)
+        {
+          m_visited.insert(s,(void*)0x8);
+          m_queue.enqueue(new QCString(s));
+        }
+      }
+      m_busy--;
+      m_changed.wakeAll();
+    }
+    void stop()
+    {
+      QMutexLocker locker(&m_mutex);
+      m_stopped=TRUE;
+      m_changed.wakeAll();
+    }
+    //! returns TRUE if directory \a path matches one of the exclude patterns
+    bool isExcluded(const QCString &path) const
+    {
+      if (m_exclMatcher==0) return FALSE;
+      int i=path.findRev('/');
+      return m_exclMatcher->match(i==-1 ? path : path.mid(i+1)) ||
+             m_exclMatcher->match(path);
+    }
+    bool followSymLinks() const { return m_followSymLinks; }
+  private:
+    const PatternMatcher *m_exclMatcher;
+    QAsciiDict<void> m_visited;
+    QQueue<QCString> m_queue;
+    QMutex           m_mutex;
+    QWaitCondition   m_changed;
+    bool             m_followSymLinks;
+    int              m_busy;
+    bool             m_stopped;
+};
+
+/** Worker thread reading the directories below an input directory, so
+ *  the directory entries and file attributes are in the caches of the file
+ *  system by the time readDir() visits the directories one by one.
+ */
+class DirPrefetchThread : public QThread
+{
+  public:
+    DirPrefetchThread(DirPrefetchQueue *queue) : m_queue(queue) {}
+    void run()
+    {
+      QCString *dirName;
+      while ((dirName=m_queue->dequeue()))
+      {
+        QStrList subDirs,toRead;
+        portable_readDirAttributes(*dirName,m_queue->followSymLinks(),subDirs);
+        const char *s;
+        for (s=subDirs.first();s;s=subDirs.next())
+        {
+          if (!m_queue->isExcluded(s)) toRead.append(s);
+        }
+        m_queue->markRead(toRead);
+        delete dirName;
+      }
+    }
+  private:
+    DirPrefetchQueue *m_queue;
+};
+
+/** Reads the directory tree starting at \a dirName on \a numThreads worker
+ *  threads, while the calling thread runs readDir() on the same tree.
+ *  The result of readDir() does not depend on it, only its speed does.
+ */
+class DirPrefetcher
+{
+  public:
+    DirPrefetcher(const char *dirName,const PatternMatcher *exclMatcher,int numThreads)
+      : m_queue(dirName,exclMatcher,!Config_getBool(EXCLUDE_SYMLINKS))
+    {
+      m_workers.setAutoDelete(TRUE);
+      int i;
+      for (i=0;i<numThreads;i++)
+      {
+        DirPrefetchThread *thread = new DirPrefetchThread(&m_queue);
+        thread->start();
+        if (thread->isRunning())
+        {
+          m_workers.append(thread);
+        }
+        else // no more threads available!
+        {
+          delete thread;
+        }
+      }
+    }
+   ~DirPrefetcher()
+    {
+      // the remaining directories are not needed anymore
+      m_queue.stop();
+      QListIterator<DirPrefetchThread> it(m_workers);
+      DirPrefetchThread *thread;
+      for (;(thread=it.current());++it)
+      {
+        thread->wait();
+      }
+    }
+  private:
+    DirPrefetchQueue        m_queue;
+    QList<DirPrefetchThread> m_workers;
+};
+
 //----------------------------------------------------------------------------
 // Read all files matching at least one pattern in 'patList' in the
 // directory represented by 'fi'.
@@ -9707,8 +10268,8 @@ int readDir(QFileInfo *fi,
             FileNameList *fnList,
             FileNameDict *fnDict,
             StringDict  *exclDict,
-            QStrList *patList,
-            QStrList *exclPatList,
+            const PatternMatcher *patMatcher,
+            const PatternMatcher *exclMatcher,
             StringList *resultList,
             StringDict *resultDict,
             bool errorIfNotExist,
@@ -9755,8 +10316,8 @@ int readDir(QFileInfo *fi,
         }
         else if (cfi->isFile() &&
             (!Config_getBool(EXCLUDE_SYMLINKS) || !cfi->isSymLink()) &&
-            (patList==0 || patternMatch(*cfi,patList)) &&
-            !patternMatch(*cfi,exclPatList) &&
+            (patMatcher==0 || patternMatch(*cfi,patMatcher)) &&
+            !patternMatch(*cfi,exclMatcher) &&
             (killDict==0 || killDict->find(cfi->absFilePath().utf8())==0)
             )
         {
@@ -9791,12 +10352,12 @@ int readDir(QFileInfo *fi,
         else if (recursive &&
             (!Config_getBool(EXCLUDE_SYMLINKS) || !cfi->isSymLink()) &&
             cfi->isDir() &&
-            !patternMatch(*cfi,exclPatList) &&
+            !patternMatch(*cfi,exclMatcher) &&
             cfi->fileName().at(0)!='.') // skip "." ".." and ".dir"
         {
           cfi->setFile(cfi->absFilePath());
           totalSize+=readDir(cfi,fnList,fnDict,exclDict,
-              patList,exclPatList,resultList,resultDict,errorIfNotExist,
+              patMatcher,exclMatcher,resultList,resultDict,errorIfNotExist,
               recursive,killDict,paths);
         }
       }
@@ -9891,9 +10452,24 @@ int readFileOrDirectory(const char *s,
         }
         else if (fi.isDir()) // readable dir
         {
-          totalSize+=readDir(&fi,fnList,fnDict,exclDict,patList,
-              exclPatList,resultList,resultDict,errorIfNotExist,
+          // compile the patterns once for the whole directory tree
+          PatternMatcher *patMatcher=0;
+          if (patList)
+          {
+            patMatcher = new PatternMatcher(patList,filePatternsCaseSensitive());
+          }
+          PatternMatcher exclMatcher(exclPatList,filePatternsCaseSensitive());
+          DirPrefetcher *prefetcher=0;
+          int numThreads = Config_getInt(NUM_PROC_THREADS);
+          if (recursive && numThreads>1)
+          {
+            prefetcher = new DirPrefetcher(fi.absFilePath().utf8(),&exclMatcher,numThreads);
+          }
+          totalSize+=readDir(&fi,fnList,fnDict,exclDict,patMatcher,
+              &exclMatcher,resultList,resultDict,errorIfNotExist,
               recursive,killDict,paths);
+          delete prefetcher;
+          delete patMatcher;
         }
       }
     }
@@ -10090,7 +10666,7 @@ static void dumpSymbolMap()
   if (f.open(IO_WriteOnly))
   {
     FTextStream t(&f);
-    QDictIterator<DefinitionIntf> di(*Doxygen::symbolMap);
+    SymbolMap::Iterator di(*Doxygen::symbolMap);
     DefinitionIntf *intf;
     for (;(intf=di.current());++di)
     {
@@ -10210,7 +10786,7 @@ void initDoxygen()
   initNamespaceMemberIndices();
   initFileMemberIndices();
 
-  Doxygen::symbolMap     = new QDict<DefinitionIntf>(50177);
+  Doxygen::symbolMap     = new SymbolMap;
 #ifdef USE_LIBCLANG
   Doxygen::clangUsrMap   = new QDict<Definition>(50177);
 #endif
@@ -10298,26 +10874,6 @@ void cleanUpDoxygen()
   Mappers::freeMappers();
   codeFreeScanner();
 
-  if (Doxygen::symbolMap)
-  {
-    // iterate through Doxygen::symbolMap and delete all
-    // DefinitionList objects, since they have no owner
-    QDictIterator<DefinitionIntf> dli(*Doxygen::symbolMap);
-    DefinitionIntf *di;
-    for (dli.toFirst();(di=dli.current());)
-    {
-      if (di->definitionType()==DefinitionIntf::TypeSymbolList)
-      {
-        DefinitionIntf *tmp = Doxygen::symbolMap->take(dli.currentKey());
-        delete (DefinitionList *)tmp;
-      }
-      else
-      {
-        ++dli;
-      }
-    }
-  }
-
   delete Doxygen::inputNameList;
   delete Doxygen::memberNameSDict;
   delete Doxygen::functionNameSDict;
@@ -10337,12 +10893,10 @@ static int computeIdealCacheParam(uint v)
 {
   //printf("computeIdealCacheParam(v=%u)\n",v);
 
+  // smallest valid cache size value for which the cache has at least v entries
   int r=0;
-  while (v!=0) v>>=1,r++;
-  // r = log2(v)
-
-  // convert to a valid cache size value
-  return QMAX(0,QMIN(r-16,9));
+  while (r<9 && (65536u<<r)<v) r++;
+  return r;
 }
 
 void readConfiguration(int argc, char **argv)
@@ -11203,8 +11757,8 @@ void parseInput()
   if (cacheSize<0) cacheSize=0;
   if (cacheSize>9) cacheSize=9;
   uint lookupSize = 65536 << cacheSize;
-  Doxygen::lookupCache = new QCache<LookupInfo>(lookupSize,lookupSize);
-  Doxygen::lookupCache->setAutoDelete(TRUE);
+  // the cache grows by itself when it is too small, up to the largest setting
+  Doxygen::lookupCache = new LookupCache(lookupSize,65536<<9);
 
 #ifdef HAS_SIGNALS
   signal(SIGINT, stopDoxygen);
@@ -11386,8 +11940,6 @@ void parseInput()
 
   // we are done with input scanning now, so free up the buffers used by flex
   // (can be around 4MB)
-  preFreeScanner();
-  scanFreeScanner();
   pyscanFreeScanner();
 
   /**************************************************************************
@@ -11563,6 +12115,13 @@ void parseInput()
   findGroupScope(root);
   g_s.end();
 
+  // this was the last pass reading the entries, everything that is needed
+  // later on has been copied into the definitions
+  g_s.begin("Freeing entry tree...\n");
+  releaseEntryTree(root);
+  root=0;
+  g_s.end();
+
   g_s.begin("Sorting lists...\n");
   Doxygen::memberNameSDict->sort();
   Doxygen::functionNameSDict->sort();
@@ -11624,7 +12183,7 @@ void parseInput()
   g_s.end();
 
   g_s.begin("Sorting member lists...\n");
-  sortMemberLists();
+  g_s.setThreads(sortMemberLists());
   g_s.end();
 
   g_s.begin("Setting anonymous enum type...\n");
@@ -11688,6 +12247,11 @@ void generateOutput()
   /// add extra languages for which we can only produce syntax highlighted code
   addCodeOnlyMappings();
 
+  // from here on the symbols and their relations are fixed, so references
+  // resolve to the same definitions on every page and for every format
+  setResolveCacheEnabled(TRUE);
+  initLinkifyFilter();
+
   //// dump all symbols
   if (g_dumpSymbolMap)
   {
@@ -12029,20 +12593,69 @@ void generateOutput()
     g_s.end();
   }
 
-  int cacheParam;
   msg("lookup cache used %d/%d hits=%d misses=%d\n",
       Doxygen::lookupCache->count(),
       Doxygen::lookupCache->size(),
       Doxygen::lookupCache->hits(),
       Doxygen::lookupCache->misses());
-  cacheParam = computeIdealCacheParam(Doxygen::lookupCache->misses()*2/3); // part of the cache is flushed, hence the 2/3 correction factor
-  if (cacheParam>Config_getInt(LOOKUP_CACHE_SIZE))
+  uint neededSize = Doxygen::lookupCache->neededSize();
+  int cacheParam = computeIdealCacheParam(neededSize);
+  if (neededSize>Doxygen::lookupCache->initialSize() &&
+      cacheParam>Config_getInt(LOOKUP_CACHE_SIZE))
   {
-    msg("Note: based on cache misses the ideal setting for LOOKUP_CACHE_SIZE is %d at the cost of higher memory usage.\n",cacheParam);
+    msg("Note: the lookup cache had to grow, setting LOOKUP_CACHE_SIZE to %d avoids this at the cost of higher initial memory usage.\n",cacheParam);
   }
 
   if (Debug::isFlagSet(Debug::Time))
   {
+    uint accessAvoided,accessComputed;
+    getAccessCacheStats(accessAvoided,accessComputed);
+    msg("accessibility cache: %u scope walks avoided, %u computed\n",
+        accessAvoided,accessComputed);
+    uint instancesCreated,instancesShared;
+    getTemplateInstanceStats(instancesCreated,instancesShared);
+    uint numMembers,numWithColdData,memberSize,coldDataSize;
+    getMemberDefStorageStats(numMembers,numWithColdData,memberSize,coldDataSize);
+    // the Definition part and the strings of a member are not counted,
+    // so the real saving is larger
+    msg("template instances: %u created, %u reused for equivalent arguments, "
+        "%u without members (%u member copies avoided, at least %u KB)\n",
+        instancesCreated,instancesShared,
+        g_numInstancesWithoutMembers,g_numInstanceMembersSkipped,
+        (uint)(((unsigned long long)g_numInstanceMembersSkipped*memberSize)/1024));
+    uint linkifySkipped,linkifyLookedUp;
+    getLinkifyFilterStats(linkifySkipped,linkifyLookedUp);
+    msg("linkify filter: %u words skipped, %u looked up\n",
+        linkifySkipped,linkifyLookedUp);
+    msg("member storage: %u members of %u bytes, %u with rarely used data of %u bytes\n",
+        numMembers,memberSize,numWithColdData,coldDataSize);
+    uint numArgLists,numArgListRequests,numArgListsShared;
+    getArgumentListPoolStats(numArgLists,numArgListRequests,numArgListsShared);
+    msg("argument list pool: %u distinct lists, %u of %u requests shared an existing list\n",
+        numArgLists,numArgListsShared,numArgListRequests);
+    uint numArenas,liveArenas;
+    uint64 arenaBytes,peakArenaBytes;
+    getEntryArenaStats(numArenas,liveArenas,arenaBytes,peakArenaBytes);
+    msg("entry arenas: %u created, %u in use holding %d entries, "
+        "%.1f MB reserved (peak %.1f MB, %.1f MB before freeing the entry tree)\n",
+        numArenas,liveArenas,Entry::num.load(),
+        arenaBytes/1048576.0,peakArenaBytes/1048576.0,
+        g_entryBytesBeforeRelease/1048576.0);
+    uint64 peakMemory = portable_peakMemoryUsage();
+    if (peakMemory>0)
+    {
+      msg("peak memory usage: %.1f MB (%.1f MB before freeing the entry tree)\n",
+          peakMemory/1048576.0,g_peakMemoryBeforeRelease/1048576.0);
+    }
+    uint resolveHits,resolveMisses;
+    getResolveCacheStats(resolveHits,resolveMisses);
+    msg("reference cache: %u references found, %u resolved\n",
+        resolveHits,resolveMisses);
+    uint argHits,typeHits,typeMisses;
+    getCanonicalTypeCacheStats(argHits,typeHits,typeMisses);
+    msg("canonical type cache: %u argument types reused, %u types found (%.1f%%), %u computed\n",
+        argHits,typeHits,typeHits+typeMisses>0 ? 100.0*typeHits/(typeHits+typeMisses) : 0.0,
+        typeMisses);
     msg("Total elapsed time: %.3f seconds\n(of which %.3f seconds waiting for external tools to finish)\n",
          ((double)Doxygen::runningTime.elapsed())/1000.0,
          portable_getSysElapsedTime()
@@ -59,6 +59,9 @@ class IndexList;
 class FormulaList;
 class FormulaDict;
 class FormulaNameDict;
+class PatternMatcher;
+class LookupCache;
+class SymbolMap;
 class SectionDict;
 struct MemberGroupInfo;
 
@@ -74,17 +77,6 @@ class StringDict : public QDict<QCString>
     virtual ~StringDict() {}
 };
 
-struct LookupInfo
-{
-  LookupInfo() : classDef(0), typeDef(0) {}
-  LookupInfo(const ClassDef *cd,const MemberDef *td,QCString ts,QCString rt)
-    : classDef(cd), typeDef(td), templSpec(ts),resolvedType(rt) {}
-  const ClassDef  *classDef;
-  const MemberDef *typeDef;
-  QCString   templSpec;
-  QCString   resolvedType;
-};
-
 extern QCString g_spaces;
 
 /*! \brief This class serves as a namespace for global variables used by doxygen.
@@ -129,11 +121,11 @@ class Doxygen
     static bool                      parseSourcesNeeded;
     static QTime                     runningTime;
     static SearchIndexIntf          *searchIndex;
-    static QDict<DefinitionIntf>    *symbolMap;
+    static SymbolMap                *symbolMap;
     static QDict<Definition>        *clangUsrMap;
     static bool                      outputToWizard;
     static QDict<int>               *htmlDirMap;
-    static QCache<LookupInfo>       *lookupCache;
+    static LookupCache              *lookupCache;
     static DirSDict                 *directories;
     static SDict<DirRelation>        dirRelations;
     static ParserManager            *parserManager;
@@ -149,9 +141,9 @@ class Doxygen
     static int                       subpageNestingLevel;
     static QCString                  spaces;
     static bool                      generatingXmlOutput;
-    static bool                      markdownSupport;
+    static thread_local bool         markdownSupport; // forced on per thread while parsing markdown
     static GenericsSDict            *genericsDict;
-    static DocGroup                  docGroup;
+    static thread_local DocGroup     docGroup; // grouping state of the file parsed by this thread
 };
 
 void initDoxygen();
@@ -181,8 +173,8 @@ int readDir(QFileInfo *fi,
             FileNameList *fnList,
             FileNameDict *fnDict,
             StringDict  *exclDict,
-            QStrList *patList,
-            QStrList *exclPatList,
+            const PatternMatcher *patMatcher,
+            const PatternMatcher *exclMatcher,
             StringList *resultList,
             StringDict *resultDict,
             bool errorIfNotExist,
@@ -17,6 +17,7 @@
 
 #include <stdlib.h>
 #include <qfile.h>
+#include <qmutex.h>
 #include "entry.h"
 #include "util.h"
 #include "section.h"
@@ -29,7 +30,174 @@
 
 //------------------------------------------------------------------
 
-int Entry::num=0;
+// most files have few entries, so the first block is small and each
+// next block is twice as large, up to the maximum
+static const int entryArenaMinBlockSize = 8*1024;
+static const int entryArenaMaxBlockSize = 256*1024;
+
+/** Memory for the Entry objects of one input file. The objects are
+ *  carved out of growing blocks, each preceded by a pointer to the arena.
+ *  Deleted objects are kept on a free list, the blocks themselves are only
+ *  freed when the arena is closed and none of its objects is alive anymore.
+ *  An arena is used by one thread at a time, but files can be parsed on
+ *  several threads at once, so the statistics are updated under a lock.
+ */
+class EntryArena
+{
+  public:
+    EntryArena() : m_blocks(0), m_cur(0), m_end(0), m_freeList(0), m_live(0),
+                   m_blockSize(entryArenaMinBlockSize), m_open(TRUE)
+    {
+      QMutexLocker locker(&s_statsMutex);
+      s_numArenas++;
+      s_liveArenas++;
+    }
+   ~EntryArena()
+    {
+      QMutexLocker locker(&s_statsMutex);
+      while (m_blocks)
+      {
+        Block *next = m_blocks->next;
+        s_bytes-=m_blocks->size;
+        free(m_blocks);
+        m_blocks = next;
+      }
+      s_liveArenas--;
+    }
+    void *alloc()
+    {
+      Header *h;
+      if (m_freeList)
+      {
+        h = m_freeList;
+        m_freeList = *(Header**)(h+1);
+      }
+      else
+      {
+        if (m_cur+slotSize>m_end) addBlock();
+        h = (Header*)m_cur;
+        m_cur+=slotSize;
+        h->arena = this;
+      }
+      m_live++;
+      return h+1;
+    }
+    //! returns TRUE if the arena can be deleted after releasing \a p
+    bool release(void *p)
+    {
+      Header *h = ((Header*)p)-1;
+      *(Header**)p = m_freeList;
+      m_freeList = h;
+      return --m_live==0 && !m_open;
+    }
+    //! returns TRUE if the arena can be deleted after closing it
+    bool close()
+    {
+      m_open = FALSE;
+      return m_live==0;
+    }
+    static EntryArena *owner(void *p)
+    {
+      return (((Header*)p)-1)->arena;
+    }
+
+    static QMutex s_statsMutex;
+    static uint   s_numArenas;
+    static uint   s_liveArenas;
+    static uint64 s_bytes;
+    static uint64 s_peakBytes;
+
+  private:
+    // keeps the objects 16 byte aligned
+    union Header { EntryArena *arena; double align[2]; };
+    struct Block { Block *next; int size; };
+    static const int slotSize = (int)(sizeof(Header)+((sizeof(Entry)+15)&~15));
+
+    void addBlock()
+    {
+      // room for the block header (which fits in a Header) and at least one object
+      int size = QMAX(m_blockSize,(int)sizeof(Header)+slotSize);
+      Block *b = (Block*)malloc(size);
+      b->next = m_blocks;
+      b->size = size;
+      m_blocks = b;
+      m_cur = (char*)b+sizeof(Header);
+      m_end = (char*)b+size;
+      m_blockSize = QMIN(m_blockSize*2,entryArenaMaxBlockSize);
+      QMutexLocker locker(&s_statsMutex);
+      s_bytes+=size;
+      if (s_bytes>s_peakBytes) s_peakBytes=s_bytes;
+    }
+
+    Block  *m_blocks;
+    char   *m_cur;
+    char   *m_end;
+    Header *m_freeList;
+    int     m_live;
+    int     m_blockSize; //!< size of the next block
+    bool    m_open;
+};
+
+QMutex EntryArena::s_statsMutex;
+uint   EntryArena::s_numArenas  = 0;
+uint   EntryArena::s_liveArenas = 0;
+uint64 EntryArena::s_bytes      = 0;
+uint64 EntryArena::s_peakBytes  = 0;
+
+// arena for the entries created outside of any EntryArenaScope, never closed
+static std::atomic<EntryArena*> g_defaultArena(0);
+static QMutex                    g_defaultArenaMutex;
+// arena of the innermost EntryArenaScope of this thread
+static thread_local EntryArena *g_currentArena = 0;
+
+void *Entry::operator new(size_t size)
+{
+  ASSERT(size==sizeof(Entry));
+  if (g_currentArena==0) // outside of any scope
+  {
+    QMutexLocker locker(&g_defaultArenaMutex);
+    if (g_defaultArena==0) g_defaultArena = new EntryArena;
+    return g_defaultArena.load()->alloc();
+  }
+  return g_currentArena->alloc();
+}
+
+void Entry::operator delete(void *p)
+{
+  if (p==0) return;
+  EntryArena *arena = EntryArena::owner(p);
+  if (arena==g_defaultArena)
+  {
+    QMutexLocker locker(&g_defaultArenaMutex);
+    arena->release(p); // never closed, so never deleted
+    return;
+  }
+  if (arena->release(p)) delete arena;
+}
+
+EntryArenaScope::EntryArenaScope() : m_prev(g_currentArena)
+{
+  g_currentArena = new EntryArena;
+}
+
+EntryArenaScope::~EntryArenaScope()
+{
+  if (g_currentArena->close()) delete g_currentArena;
+  g_currentArena = m_prev;
+}
+
+void getEntryArenaStats(uint &numArenas,uint &liveArenas,uint64 &bytes,uint64 &peakBytes)
+{
+  QMutexLocker locker(&EntryArena::s_statsMutex);
+  numArenas  = EntryArena::s_numArenas;
+  liveArenas = EntryArena::s_liveArenas;
+  bytes      = EntryArena::s_bytes;
+  peakBytes  = EntryArena::s_peakBytes;
+}
+
+//------------------------------------------------------------------
+
+std::atomic<int> Entry::num(0);
 
 Entry::Entry()
 {
@@ -23,12 +23,15 @@
 #include <qlist.h>
 #include <qgstring.h>
 
+#include <atomic>
+
 struct SectionInfo;
 class QFile;
 class FileDef;
 class FileStorage;
 class StorageIntf;
 class ArgumentList;
+class EntryArena;
 struct ListItemInfo;
 
 /** This class stores information about an inheritance relation
@@ -194,6 +197,10 @@ class Entry
     Entry(const Entry &);
    ~Entry();
 
+    /*! Entries are allocated from the current arena, see EntryArenaScope */
+    static void *operator new(size_t size);
+    static void operator delete(void *p);
+
     /*! Returns the static size of the Entry (so excluding any dynamic memory) */
     int getSize();
 
@@ -293,7 +300,7 @@ class Entry
     QCString    metaData;     //!< Slice metadata
 
 
-    static int  num;          //!< counts the total number of entries
+    static std::atomic<int> num; //!< counts the total number of entries
 
     /// return the command name used to define GROUPDOC_SEC
     const char *groupDocCmd() const
@@ -331,4 +338,24 @@ class Entry
 typedef QList<Entry> EntryList;
 typedef QListIterator<Entry> EntryListIterator;
 
+/** Makes the Entry objects that are created during the lifetime of this
+ *  object come from a new arena, typically one per input file.
+ *  The memory of the arena is freed in one go when the scope has ended
+ *  and the last of its entries has been deleted.
+ */
+class EntryArenaScope
+{
+  public:
+    EntryArenaScope();
+   ~EntryArenaScope();
+  private:
+    EntryArena *m_prev;
+};
+
+/*! Returns the number of arenas created for Entry objects, the number
+ *  of arenas that are still in use, and the current and peak number of
+ *  bytes reserved by the arenas.
+ */
+void getEntryArenaStats(uint &numArenas,uint &liveArenas,uint64 &bytes,uint64 &peakBytes);
+
 #endif
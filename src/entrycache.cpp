@@ -0,0 +1,647 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#include <ctype.h>
+
+#include <qfile.h>
+#include <qdir.h>
+#include <qdatastream.h>
+#include <qmutex.h>
+
+#include "md5.h"
+#include "entrycache.h"
+#include "entry.h"
+#include "arguments.h"
+#include "section.h"
+#include "formula.h"
+#include "doxygen.h"
+#include "config.h"
+#include "message.h"
+#include "bufstr.h"
+#include "util.h"
+#include "portable.h"
+#include "version.h"
+#include "parseorder.h"
+
+//------------------------------------------------------------------
+
+// change the format version when the layout of the stored data changes
+#define ENTRYCACHE_MAGIC   (('D'<<24)+('X'<<16)+('E'<<8)+'C')
+#define ENTRYCACHE_VERSION 1
+
+//------------------------------------------------------------------
+
+static void addOption(QCString &sig,const char *name,bool value)
+{
+  sig+=QCString(name)+"="+(value ? "YES" : "NO")+"\n";
+}
+
+static void addOption(QCString &sig,const char *name,int value)
+{
+  sig+=QCString(name)+"="+QCString().setNum(value)+"\n";
+}
+
+static void addOption(QCString &sig,const char *name,const QCString &value)
+{
+  sig+=QCString(name)+"="+value+"\n";
+}
+
+static void addOption(QCString &sig,const char *name,const QStrList &value)
+{
+  sig+=QCString(name)+"=";
+  QStrListIterator sli(value);
+  const char *s;
+  for (sli.toFirst();(s=sli.current());++sli)
+  {
+    sig+=QCString(s)+"\t";
+  }
+  sig+="\n";
+}
+
+#define ADD_OPTION(sig,type,name) addOption(sig,#name,Config_get##type(name))
+
+/** Builds a string with the values of all options that influence the
+ *  Entry tree produced by the parsers.
+ */
+static QCString configSignature()
+{
+  QCString sig;
+  sig.sprintf("%s:%d\n",getVersion(),ENTRYCACHE_VERSION);
+  // options used by the parsers and the comment scanner
+  ADD_OPTION(sig,Bool,CALL_GRAPH);
+  ADD_OPTION(sig,Bool,CALLER_GRAPH);
+  ADD_OPTION(sig,Bool,REFERENCED_BY_RELATION);
+  ADD_OPTION(sig,Bool,REFERENCES_RELATION);
+  ADD_OPTION(sig,Bool,CPP_CLI_SUPPORT);
+  ADD_OPTION(sig,Bool,SIP_SUPPORT);
+  ADD_OPTION(sig,Bool,IDL_PROPERTY_SUPPORT);
+  ADD_OPTION(sig,Bool,BUILTIN_STL_SUPPORT);
+  ADD_OPTION(sig,Bool,EXTRACT_ANON_NSPACES);
+  ADD_OPTION(sig,Bool,FORCE_LOCAL_INCLUDES);
+  ADD_OPTION(sig,Bool,GROUP_NESTED_COMPOUNDS);
+  ADD_OPTION(sig,Bool,HIDE_IN_BODY_DOCS);
+  ADD_OPTION(sig,Bool,INTERNAL_DOCS);
+  ADD_OPTION(sig,Bool,JAVADOC_AUTOBRIEF);
+  ADD_OPTION(sig,Bool,JAVADOC_BANNER);
+  ADD_OPTION(sig,Bool,QT_AUTOBRIEF);
+  ADD_OPTION(sig,Bool,MULTILINE_CPP_IS_BRIEF);
+  ADD_OPTION(sig,Bool,MARKDOWN_SUPPORT);
+  ADD_OPTION(sig,Bool,TYPEDEF_HIDES_STRUCT);
+  ADD_OPTION(sig,Bool,OPTIMIZE_OUTPUT_FOR_C);
+  ADD_OPTION(sig,Bool,OPTIMIZE_OUTPUT_JAVA);
+  ADD_OPTION(sig,Bool,OPTIMIZE_FOR_FORTRAN);
+  ADD_OPTION(sig,Bool,OPTIMIZE_OUTPUT_VHDL);
+  ADD_OPTION(sig,Bool,OPTIMIZE_OUTPUT_SLICE);
+  ADD_OPTION(sig,Int,TAB_SIZE);
+  ADD_OPTION(sig,Int,TOC_INCLUDE_HEADINGS);
+  ADD_OPTION(sig,Enum,OUTPUT_LANGUAGE);
+  ADD_OPTION(sig,String,USE_MDFILE_AS_MAINPAGE);
+  ADD_OPTION(sig,String,INPUT_ENCODING);
+  ADD_OPTION(sig,List,EXTENSION_MAPPING);
+  ADD_OPTION(sig,List,ENABLED_SECTIONS);
+  ADD_OPTION(sig,List,ALIASES);
+  ADD_OPTION(sig,List,IMAGE_PATH);
+  // options used by the preprocessor
+  ADD_OPTION(sig,Bool,ENABLE_PREPROCESSING);
+  ADD_OPTION(sig,Bool,MACRO_EXPANSION);
+  ADD_OPTION(sig,Bool,EXPAND_ONLY_PREDEF);
+  ADD_OPTION(sig,Bool,SEARCH_INCLUDES);
+  ADD_OPTION(sig,Bool,SKIP_FUNCTION_MACROS);
+  ADD_OPTION(sig,List,PREDEFINED);
+  ADD_OPTION(sig,List,EXPAND_AS_DEFINED);
+  ADD_OPTION(sig,List,INCLUDE_PATH);
+  ADD_OPTION(sig,List,INCLUDE_FILE_PATTERNS);
+  return sig;
+}
+
+#undef ADD_OPTION
+
+//------------------------------------------------------------------
+
+static void writeArgumentList(QDataStream &s,const ArgumentList *al)
+{
+  if (al==0)
+  {
+    s << (Q_INT32)-1;
+    return;
+  }
+  s << (Q_INT32)al->count();
+  ArgumentListIterator ali(*al);
+  const Argument *a;
+  for (;(a=ali.current());++ali)
+  {
+    s << a->attrib << a->type << a->canType << a->name
+      << a->array << a->defval << a->docs << a->typeConstraint;
+  }
+  s << (Q_UINT8)al->constSpecifier << (Q_UINT8)al->volatileSpecifier
+    << (Q_UINT8)al->pureSpecifier << al->trailingReturnType
+    << (Q_UINT8)al->isDeleted << (Q_INT32)al->refQualifier;
+}
+
+static bool readArgumentList(QDataStream &s,ArgumentList *&al)
+{
+  Q_INT32 count;
+  s >> count;
+  if (count<0)
+  {
+    al=0;
+    return !s.atEnd();
+  }
+  al = new ArgumentList;
+  int i;
+  for (i=0;i<count && !s.atEnd();i++)
+  {
+    Argument *a = new Argument;
+    s >> a->attrib >> a->type >> a->canType >> a->name
+      >> a->array >> a->defval >> a->docs >> a->typeConstraint;
+    al->append(a);
+  }
+  Q_UINT8 constSpec,volatileSpec,pureSpec,isDeleted;
+  Q_INT32 refQual;
+  s >> constSpec >> volatileSpec >> pureSpec >> al->trailingReturnType
+    >> isDeleted >> refQual;
+  al->constSpecifier    = constSpec;
+  al->volatileSpecifier = volatileSpec;
+  al->pureSpecifier     = pureSpec;
+  al->isDeleted         = isDeleted;
+  al->refQualifier      = (RefQualifierType)refQual;
+  return i==count && !s.atEnd();
+}
+
+static void writeEntry(QDataStream &s,const Entry *e)
+{
+  s << (Q_INT32)e->section << e->type << e->name;
+  s << (Q_UINT8)(e->tagInfo!=0);
+  if (e->tagInfo)
+  {
+    s << e->tagInfo->tagName << e->tagInfo->fileName << e->tagInfo->anchor;
+  }
+  s << (Q_INT32)e->protection << (Q_INT32)e->mtype << (Q_UINT64)e->spec
+    << (Q_INT32)e->initLines;
+  Q_UINT32 flags = (e->stat                 ? 0x0001 : 0) |
+                   (e->explicitExternal     ? 0x0002 : 0) |
+                   (e->proto                ? 0x0004 : 0) |
+                   (e->subGrouping          ? 0x0008 : 0) |
+                   (e->callGraph            ? 0x0010 : 0) |
+                   (e->callerGraph          ? 0x0020 : 0) |
+                   (e->referencedByRelation ? 0x0040 : 0) |
+                   (e->referencesRelation   ? 0x0080 : 0) |
+                   (e->hidden               ? 0x0100 : 0) |
+                   (e->artificial           ? 0x0200 : 0);
+  s << flags;
+  s << (Q_INT32)e->virt << e->args << e->bitfields;
+  writeArgumentList(s,e->argList);
+  if (e->tArgLists)
+  {
+    s << (Q_INT32)e->tArgLists->count();
+    QListIterator<ArgumentList> ali(*e->tArgLists);
+    const ArgumentList *al;
+    for (;(al=ali.current());++ali)
+    {
+      writeArgumentList(s,al);
+    }
+  }
+  else
+  {
+    s << (Q_INT32)-1;
+  }
+  s << QCString(e->program.data()) << QCString(e->initializer.data());
+  s << e->includeFile << e->includeName;
+  s << e->doc << (Q_INT32)e->docLine << e->docFile;
+  s << e->brief << (Q_INT32)e->briefLine << e->briefFile;
+  s << e->inbodyDocs << (Q_INT32)e->inbodyLine << e->inbodyFile;
+  s << e->relates << (Q_INT32)e->relatesType;
+  s << e->read << e->write << e->inside << e->exception;
+  writeArgumentList(s,e->typeConstr);
+  s << (Q_INT32)e->bodyLine << (Q_INT32)e->endBodyLine;
+  s << (Q_INT32)e->extends->count();
+  QListIterator<BaseInfo> bii(*e->extends);
+  const BaseInfo *bi;
+  for (;(bi=bii.current());++bii)
+  {
+    s << bi->name << (Q_INT32)bi->prot << (Q_INT32)bi->virt;
+  }
+  s << (Q_INT32)e->groups->count();
+  QListIterator<Grouping> gli(*e->groups);
+  const Grouping *g;
+  for (;(g=gli.current());++gli)
+  {
+    s << g->groupname << (Q_INT32)g->pri;
+  }
+  s << (Q_INT32)e->anchors->count();
+  QListIterator<SectionInfo> sii(*e->anchors);
+  const SectionInfo *si;
+  for (;(si=sii.current());++sii)
+  {
+    s << si->label << si->title << (Q_INT32)si->type << si->ref
+      << si->fileName << (Q_INT32)si->lineNr << (Q_UINT8)si->generated
+      << (Q_INT32)si->level;
+  }
+  s << e->fileName << (Q_INT32)e->startLine << (Q_INT32)e->startColumn;
+  s << (Q_INT32)e->lang << (Q_INT32)e->groupDocType << e->id << e->metaData;
+  s << (Q_INT32)e->localToc.mask()
+    << (Q_INT32)e->localToc.htmlLevel() << (Q_INT32)e->localToc.latexLevel()
+    << (Q_INT32)e->localToc.xmlLevel()  << (Q_INT32)e->localToc.docbookLevel()
+    << (Q_INT32)e->localToc.asciidocLevel();
+
+  s << (Q_INT32)e->children()->count();
+  EntryListIterator eli(*e->children());
+  const Entry *child;
+  for (;(child=eli.current());++eli)
+  {
+    writeEntry(s,child);
+  }
+}
+
+static bool readEntry(QDataStream &s,Entry *e)
+{
+  Q_INT32 i32,count;
+  Q_UINT8 u8;
+  Q_UINT32 flags;
+  int i;
+  s >> i32; e->section = i32;
+  s >> e->type >> e->name;
+  s >> u8;
+  if (u8)
+  {
+    e->tagInfo = new TagInfo;
+    s >> e->tagInfo->tagName >> e->tagInfo->fileName >> e->tagInfo->anchor;
+  }
+  Q_UINT64 spec;
+  s >> i32; e->protection = (Protection)i32;
+  s >> i32; e->mtype      = (MethodTypes)i32;
+  s >> spec; e->spec      = spec;
+  s >> i32; e->initLines  = i32;
+  s >> flags;
+  e->stat                 = (flags & 0x0001)!=0;
+  e->explicitExternal     = (flags & 0x0002)!=0;
+  e->proto                = (flags & 0x0004)!=0;
+  e->subGrouping          = (flags & 0x0008)!=0;
+  e->callGraph            = (flags & 0x0010)!=0;
+  e->callerGraph          = (flags & 0x0020)!=0;
+  e->referencedByRelation = (flags & 0x0040)!=0;
+  e->referencesRelation   = (flags & 0x0080)!=0;
+  e->hidden               = (flags & 0x0100)!=0;
+  e->artificial           = (flags & 0x0200)!=0;
+  s >> i32; e->virt = (Specifier)i32;
+  s >> e->args >> e->bitfields;
+  delete e->argList;
+  if (!readArgumentList(s,e->argList)) return FALSE;
+  if (e->argList==0) e->argList = new ArgumentList;
+  s >> count;
+  if (count>=0)
+  {
+    e->tArgLists = new QList<ArgumentList>;
+    e->tArgLists->setAutoDelete(TRUE);
+    for (i=0;i<count;i++)
+    {
+      ArgumentList *al;
+      if (!readArgumentList(s,al)) return FALSE;
+      if (al) e->tArgLists->append(al);
+    }
+  }
+  QCString str;
+  s >> str; e->program     = str.data();
+  s >> str; e->initializer = str.data();
+  s >> e->includeFile >> e->includeName;
+  s >> e->doc;        s >> i32; e->docLine    = i32; s >> e->docFile;
+  s >> e->brief;      s >> i32; e->briefLine  = i32; s >> e->briefFile;
+  s >> e->inbodyDocs; s >> i32; e->inbodyLine = i32; s >> e->inbodyFile;
+  s >> e->relates;    s >> i32; e->relatesType = (RelatesType)i32;
+  s >> e->read >> e->write >> e->inside >> e->exception;
+  if (!readArgumentList(s,e->typeConstr)) return FALSE;
+  s >> i32; e->bodyLine    = i32;
+  s >> i32; e->endBodyLine = i32;
+  s >> count;
+  for (i=0;i<count && !s.atEnd();i++)
+  {
+    QCString name;
+    Q_INT32 prot,virt;
+    s >> name >> prot >> virt;
+    e->extends->append(new BaseInfo(name,(Protection)prot,(Specifier)virt));
+  }
+  s >> count;
+  for (i=0;i<count && !s.atEnd();i++)
+  {
+    QCString groupName;
+    Q_INT32 pri;
+    s >> groupName >> pri;
+    e->groups->append(new Grouping(groupName,(Grouping::GroupPri_t)pri));
+  }
+  s >> count;
+  for (i=0;i<count && !s.atEnd();i++)
+  {
+    QCString label,title,ref,fileName;
+    Q_INT32 type,lineNr,level;
+    Q_UINT8 generated;
+    s >> label >> title >> type >> ref >> fileName >> lineNr >> generated >> level;
+    SectionInfo *si = new SectionInfo(fileName,lineNr,label,title,
+                                      (SectionInfo::SectionType)type,level,ref);
+    si->generated = generated;
+    e->anchors->append(si);
+  }
+  s >> e->fileName;
+  s >> i32; e->startLine   = i32;
+  s >> i32; e->startColumn = i32;
+  s >> i32; e->lang         = (SrcLangExt)i32;
+  s >> i32; e->groupDocType = (Entry::GroupDocType)i32;
+  s >> e->id >> e->metaData;
+  Q_INT32 tocMask,tocHtml,tocLatex,tocXml,tocDocbook,tocAsciidoc;
+  s >> tocMask >> tocHtml >> tocLatex >> tocXml >> tocDocbook >> tocAsciidoc;
+  e->localToc = LocalToc();
+  if (tocAsciidoc>0)                       e->localToc.enableAsciidoc(tocAsciidoc);
+  if (tocMask & (1<<LocalToc::Html))       e->localToc.enableHtml(tocHtml);
+  if (tocMask & (1<<LocalToc::Latex))      e->localToc.enableLatex(tocLatex);
+  if (tocMask & (1<<LocalToc::Xml))        e->localToc.enableXml(tocXml);
+  if (tocMask & (1<<LocalToc::Docbook))    e->localToc.enableDocbook(tocDocbook);
+
+  s >> count;
+  for (i=0;i<count && !s.atEnd();i++)
+  {
+    Entry *child = new Entry;
+    e->addSubEntry(child);
+    if (!readEntry(s,child)) return FALSE;
+  }
+  return i==count && !s.atEnd();
+}
+
+/** Frees the anchors of a tree that could not be read completely, they are
+ *  not owned by the tree since the entries are not in Doxygen::sectionDict yet.
+ */
+static void deleteAnchors(Entry *e)
+{
+  QListIterator<SectionInfo> sii(*e->anchors);
+  SectionInfo *si;
+  for (;(si=sii.current());++sii)
+  {
+    delete si;
+  }
+  e->anchors->clear();
+  EntryListIterator eli(*e->children());
+  Entry *child;
+  for (;(child=eli.current());++eli)
+  {
+    deleteAnchors(child);
+  }
+}
+
+/** Adds the anchors of a tree read from the cache to Doxygen::sectionDict,
+ *  like the comment scanner does while parsing.
+ */
+static void addAnchors(Entry *e)
+{
+  QListIterator<SectionInfo> sii(*e->anchors);
+  SectionInfo *si;
+  for (sii.toFirst();(si=sii.current());)
+  {
+    ++sii;
+    SectionInfo *osi = Doxygen::sectionDict->find(si->label);
+    if (osi)
+    {
+      if (osi->lineNr != -1)
+      {
+        warn(si->fileName,si->lineNr,"multiple use of section label '%s', (first occurrence: %s, line %d)",si->label.data(),osi->fileName.data(),osi->lineNr);
+      }
+      else
+      {
+        warn(si->fileName,si->lineNr,"multiple use of section label '%s', (first occurrence: %s)",si->label.data(),osi->fileName.data());
+      }
+      e->anchors->removeRef(si);
+      delete si;
+    }
+    else
+    {
+      Doxygen::sectionDict->append(si->label,si);
+    }
+  }
+  EntryListIterator eli(*e->children());
+  Entry *child;
+  for (;(child=eli.current());++eli)
+  {
+    addAnchors(child);
+  }
+}
+
+static bool refersToGlobalState(const QCString &doc)
+{
+  return doc.find("\\form#")!=-1 || doc.find("\\cite")!=-1 || doc.find("@cite")!=-1;
+}
+
+static bool isAnonymousName(const QCString &name)
+{
+  int i=name.find('@');
+  return i!=-1 && i<(int)name.length()-1 && isdigit(name.at(i+1));
+}
+
+/** Returns TRUE if the tree refers to information that is created while
+ *  parsing and that is not stored in the tree itself.
+ */
+static bool hasExternalReferences(const Entry *e)
+{
+  if ((e->sli && !e->sli->isEmpty()) || e->mGrpId!=-1 ||
+      isAnonymousName(e->name) || isAnonymousName(e->type) ||
+      refersToGlobalState(e->doc) || refersToGlobalState(e->brief) ||
+      refersToGlobalState(e->inbodyDocs))
+  {
+    return TRUE;
+  }
+  EntryListIterator eli(*e->children());
+  const Entry *child;
+  for (;(child=eli.current());++eli)
+  {
+    if (hasExternalReferences(child)) return TRUE;
+  }
+  return FALSE;
+}
+
+//------------------------------------------------------------------
+
+struct EntryCache::Private
+{
+  QCString dirName;
+  QCString configSig;
+  QMutex mutex; // guards the counters, files may be parsed on several threads
+  int hits;
+  int misses;
+  // state of the global dictionaries at the start of parsing a file,
+  // only used when the files are parsed one at a time
+  uint formulaCount;
+  uint aliasCount;
+  uint memGrpCount;
+  int  warnCount;
+};
+
+EntryCache::EntryCache(const char *dirName) : p(new Private)
+{
+  p->dirName   = dirName;
+  p->configSig = configSignature();
+  p->hits      = 0;
+  p->misses    = 0;
+  p->formulaCount = 0;
+  p->aliasCount   = 0;
+  p->memGrpCount  = 0;
+  p->warnCount    = 0;
+  QDir dir(p->dirName);
+  if (!dir.exists() && !dir.mkdir(dir.absPath()))
+  {
+    err("Could not create entry cache directory %s, caching disabled\n",dir.absPath().data());
+    p->dirName.resize(0);
+  }
+  else
+  {
+    p->dirName = dir.absPath().utf8();
+  }
+}
+
+EntryCache::~EntryCache()
+{
+  delete p;
+}
+
+bool EntryCache::isCacheable(const char *fileName) const
+{
+  if (p->dirName.isEmpty()) return FALSE;
+  // only the C-like languages are handled by a parser that does not keep
+  // state between files
+  switch (getLanguageFromFileName(fileName))
+  {
+    case SrcLangExt_Cpp:
+    case SrcLangExt_ObjC:
+    case SrcLangExt_Java:
+    case SrcLangExt_CSharp:
+    case SrcLangExt_D:
+    case SrcLangExt_PHP:
+    case SrcLangExt_IDL:
+    case SrcLangExt_JS:
+    case SrcLangExt_Slice:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+QCString EntryCache::key(const char *fileName,const BufStr &input) const
+{
+  struct MD5Context ctx;
+  uchar md5_sig[16];
+  QCString sigStr(33);
+  MD5Init(&ctx);
+  MD5Update(&ctx,(const uchar *)p->configSig.data(),p->configSig.length()+1);
+  MD5Update(&ctx,(const uchar *)fileName,qstrlen(fileName)+1);
+  MD5Update(&ctx,(const uchar *)input.data(),input.curPos());
+  MD5Final(md5_sig,&ctx);
+  MD5SigToString(md5_sig,sigStr.rawData(),33);
+  return sigStr;
+}
+
+Entry *EntryCache::load(const QCString &key)
+{
+  QFile f(p->dirName+"/"+key);
+  if (!f.open(IO_ReadOnly))
+  {
+    QMutexLocker locker(&p->mutex);
+    p->misses++;
+    return 0;
+  }
+  QDataStream s(&f);
+  Q_UINT32 magic,version;
+  s >> magic >> version;
+  Entry *root=0;
+  bool ok=FALSE;
+  if (magic==ENTRYCACHE_MAGIC && version==ENTRYCACHE_VERSION)
+  {
+    root = new Entry;
+    ok = readEntry(s,root);
+    s >> magic;
+    ok = ok && magic==ENTRYCACHE_MAGIC;
+  }
+  if (!ok)
+  {
+    warn_uncond("ignoring invalid entry cache file %s\n",f.name().data());
+    if (root)
+    {
+      deleteAnchors(root);
+      delete root;
+    }
+    QMutexLocker locker(&p->mutex);
+    p->misses++;
+    return 0;
+  }
+  ParseOrder::waitForTurn();
+  addAnchors(root);
+  QMutexLocker locker(&p->mutex);
+  p->hits++;
+  return root;
+}
+
+void EntryCache::startParse()
+{
+  if (ParseOrder::isBound()) return; // store() checks the turn instead
+  p->formulaCount = Doxygen::formulaList->count();
+  p->aliasCount   = Doxygen::namespaceAliasDict.count();
+  p->memGrpCount  = Doxygen::memGrpInfoDict.count();
+  p->warnCount    = warningCount();
+}
+
+void EntryCache::store(const QCString &key,const Entry *fileRoot)
+{
+  if (ParseOrder::isBound())
+  {
+    // other files change the global dictionaries meanwhile, but this file
+    // had to wait for its turn before it could change them or warn
+    if (ParseOrder::hadTurn()) return;
+  }
+  else if (Doxygen::formulaList->count()       != p->formulaCount ||
+           Doxygen::namespaceAliasDict.count() != p->aliasCount   ||
+           Doxygen::memGrpInfoDict.count()     != p->memGrpCount  ||
+           warningCount()                      != p->warnCount)
+  {
+    return;
+  }
+  if (hasExternalReferences(fileRoot))
+  {
+    return;
+  }
+  // write to a temporary file first, so concurrent runs never see a partial file
+  QCString fileName = p->dirName+"/"+key;
+  QCString tmpName;
+  tmpName.sprintf("%s.%d.tmp",fileName.data(),portable_pid());
+  QFile f(tmpName);
+  if (!f.open(IO_WriteOnly))
+  {
+    return;
+  }
+  QDataStream s(&f);
+  s << (Q_UINT32)ENTRYCACHE_MAGIC << (Q_UINT32)ENTRYCACHE_VERSION;
+  writeEntry(s,fileRoot);
+  s << (Q_UINT32)ENTRYCACHE_MAGIC;
+  bool ok = f.status()==IO_Ok;
+  f.close();
+  QDir dir(p->dirName);
+  if (!ok || !dir.rename(tmpName,fileName))
+  {
+    dir.remove(tmpName);
+  }
+}
+
+int EntryCache::hits() const
+{
+  return p->hits;
+}
+
+int EntryCache::misses() const
+{
+  return p->misses;
+}
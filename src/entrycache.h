@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#ifndef ENTRYCACHE_H
+#define ENTRYCACHE_H
+
+#include <qcstring.h>
+
+class Entry;
+class BufStr;
+
+/** @brief On-disk cache of the Entry trees produced by the language parsers.
+ *
+ *  Each tree is stored in its own file in the directory set with
+ *  ENTRY_CACHE_DIR. The name of the file is an MD5 hash over the
+ *  (preprocessed) input that is passed to the parser, the name of the
+ *  input file and the configuration options that influence parsing.
+ *
+ *  Only trees for which parsing did not leave any traces outside of the
+ *  tree itself (formulas, citations, member groups, xref list items,
+ *  numbered anonymous scopes, warnings) are stored, so that using a
+ *  stored tree gives the same result as parsing the file again.
+ */
+class EntryCache
+{
+  public:
+    EntryCache(const char *dirName);
+   ~EntryCache();
+
+    /** Returns TRUE if trees for \a fileName can be cached. */
+    bool isCacheable(const char *fileName) const;
+
+    /** Computes the key for \a fileName whose parser input is \a input. */
+    QCString key(const char *fileName,const BufStr &input) const;
+
+    /** Returns a new tree for \a key or 0 if no (valid) tree was stored.
+     *  The anchors of the tree are added to Doxygen::sectionDict.
+     */
+    Entry *load(const QCString &key);
+
+    /** Must be called before the file with \a key is parsed. */
+    void startParse();
+
+    /** Stores the tree \a fileRoot under \a key, unless parsing the file
+     *  had side effects since the last call to startParse().
+     */
+    void store(const QCString &key,const Entry *fileRoot);
+
+    /** Returns the number of trees that were read from the cache. */
+    int hits() const;
+
+    /** Returns the number of cacheable trees that had to be parsed. */
+    int misses() const;
+
+  private:
+    struct Private;
+    Private *p;
+};
+
+#endif
@@ -55,7 +55,7 @@ class FileDefImpl : public DefinitionImpl, public FileDef
     virtual ~FileDefImpl();
 
     virtual DefType definitionType() const { return TypeFile; }
-    virtual QCString name() const;
+    virtual const QCString &name() const;
     virtual QCString displayName(bool=TRUE) const { return name(); }
     virtual QCString fileName() const { return m_fileName; }
     virtual QCString getOutputFileBase() const;
@@ -1469,7 +1469,7 @@ void FileDefImpl::insertNamespace(NamespaceDef *nd)
   }
 }
 
-QCString FileDefImpl::name() const 
+const QCString &FileDefImpl::name() const 
 { 
   if (Config_getBool(FULL_PATH_NAMES)) 
     return m_fileName; 
@@ -1516,6 +1516,7 @@ MemberDef *FileDefImpl::getSourceMember(int lineNr) const
 
 void FileDefImpl::addUsingDirective(const NamespaceDef *nd)
 {
+  invalidateAccessCache();
   if (m_usingDirList==0)
   {
     m_usingDirList = new NamespaceSDict;
@@ -1535,6 +1536,7 @@ NamespaceSDict *FileDefImpl::getUsedNamespaces() const
 
 void FileDefImpl::addUsingDeclaration(Definition *d)
 {
+  invalidateAccessCache();
   if (m_usingDeclList==0)
   {
     m_usingDeclList = new SDict<Definition>(17);
@@ -397,7 +397,7 @@ bool GroupDefImpl::insertMember(MemberDef *md,bool docOnly)
                md->getOuterScope()->definitionType()==Definition::TypeFile); 
 
       const ArgumentList *srcMdAl  = srcMd->argumentList();
-      const ArgumentList *mdAl     = md->argumentList();
+      const ArgumentList *mdAl     = argumentListForMatching(md,srcMdAl);
       const ArgumentList *tSrcMdAl = srcMd->templateArguments();
       const ArgumentList *tMdAl    = md->templateArguments();
       
@@ -0,0 +1,352 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#include <string.h>
+
+#include <qcache.h>
+#include <qdict.h>
+#include <qmutex.h>
+
+#include "lookupcache.h"
+
+static const int  numShards = 16;     // must be a power of 2
+static const uint ghostSize = 4096;   // number of remembered evictions per shard
+
+// identifies the calling thread
+static thread_local char g_threadTag;
+
+// keys the calling thread is computing a result for. These are kept apart
+// from the cache, since another thread may already have a pending entry for
+// the same key, and since a pending entry may be evicted before it is replaced.
+static thread_local QDict<void> g_pendingKeys(257);
+
+struct LookupCacheShard;
+
+/** Entry of a LookupCacheShard */
+struct LookupCacheEntry
+{
+  LookupCacheEntry(LookupCacheShard *s,uint h,uint gen)
+    : shard(s), hash(h), generation(gen), pendingOwner(0) {}
+  inline ~LookupCacheEntry();
+  LookupInfo info;
+  LookupCacheShard *shard;
+  uint hash;              //!< hash of the key
+  uint generation;        //!< generation of the cache when info was stored
+  const void *pendingOwner; //!< thread computing info, or 0 if info is final
+};
+
+/** Part of the LookupCache with its own lock */
+struct LookupCacheShard
+{
+  LookupCacheShard(uint initialSize,uint max)
+    : maxSize(max), removing(FALSE), ghostHits(0), hits(0), misses(0)
+  {
+    cache = newCache(initialSize);
+    memset(ghosts,0,sizeof(ghosts));
+  }
+ ~LookupCacheShard()
+  {
+    removing=TRUE;
+    delete cache;
+  }
+  static QCache<LookupCacheEntry> *newCache(uint size)
+  {
+    QCache<LookupCacheEntry> *c = new QCache<LookupCacheEntry>(size,size|1);
+    c->setAutoDelete(TRUE);
+    return c;
+  }
+  //! called for entries that are evicted to make room for others
+  void evicted(uint hash)
+  {
+    ghosts[hash%ghostSize]=hash|1;
+  }
+  //! called when looking up a key that is not in the cache
+  void missed(uint hash)
+  {
+    uint &g = ghosts[hash%ghostSize];
+    if (g==(hash|1)) // looked up again after it was evicted
+    {
+      g=0;
+      ghostHits++;
+      uint size = (uint)cache->maxCost();
+      if (ghostHits>size/8 && size<maxSize)
+      {
+        grow(QMIN(size*2,maxSize));
+      }
+    }
+  }
+  //! moves the entries to a larger cache, keeping their order of use
+  void grow(uint size)
+  {
+    QCache<LookupCacheEntry> *c = newCache(size);
+    QCacheIterator<LookupCacheEntry> it(*cache);
+    LookupCacheEntry *e;
+    for (it.toLast();(e=it.current());--it)
+    {
+      c->insert(it.currentKey(),e);
+    }
+    cache->setAutoDelete(FALSE);
+    delete cache;
+    cache=c;
+    ghostHits=0;
+  }
+  void remove(const char *key)
+  {
+    removing=TRUE;
+    cache->remove(key);
+    removing=FALSE;
+  }
+  QMutex mutex;
+  QCache<LookupCacheEntry> *cache;
+  uint maxSize;
+  bool removing;          //!< TRUE if entries are removed instead of evicted
+  uint ghosts[ghostSize]; //!< hashes of recently evicted keys
+  uint ghostHits;
+  uint hits;
+  uint misses;
+};
+
+inline LookupCacheEntry::~LookupCacheEntry()
+{
+  if (!shard->removing) shard->evicted(hash);
+}
+
+struct LookupCache::Private
+{
+  Private() : initialSize(0), generation(0), resolvedValidFrom(0), unresolvedValidFrom(0) {}
+  LookupCacheShard *shards[numShards];
+  uint initialSize;
+  uint generation;
+  uint resolvedValidFrom;   //!< results found a class are valid from this generation
+  uint unresolvedValidFrom; //!< empty results are valid from this generation
+
+  static uint hash(const char *key)
+  {
+    uint h=2166136261u;
+    while (*key) h=(h^(uchar)*key++)*16777619u;
+    return h;
+  }
+  bool isStale(const LookupCacheEntry *e) const
+  {
+    if (e->info.classDef)
+    {
+      return e->generation<resolvedValidFrom;
+    }
+    else if (e->info.typeDef==0)
+    {
+      return e->generation<unresolvedValidFrom;
+    }
+    return FALSE;
+  }
+  void lockAll()
+  {
+    int i;
+    for (i=0;i<numShards;i++) shards[i]->mutex.lock();
+  }
+  void unlockAll()
+  {
+    int i;
+    for (i=numShards-1;i>=0;i--) shards[i]->mutex.unlock();
+  }
+};
+
+LookupCache::LookupCache(uint initialSize,uint maxSize) : p(new Private)
+{
+  uint shardSize    = QMAX(initialSize/numShards,1);
+  uint shardMaxSize = QMAX(maxSize/numShards,shardSize);
+  p->initialSize = shardSize*numShards;
+  int i;
+  for (i=0;i<numShards;i++)
+  {
+    p->shards[i] = new LookupCacheShard(shardSize,shardMaxSize);
+  }
+}
+
+LookupCache::~LookupCache()
+{
+  int i;
+  for (i=0;i<numShards;i++)
+  {
+    delete p->shards[i];
+  }
+  delete p;
+}
+
+bool LookupCache::find(const char *key,LookupInfo &info)
+{
+  uint h = Private::hash(key);
+  LookupCacheShard *s = p->shards[(h>>16)&(numShards-1)];
+  QMutexLocker locker(&s->mutex);
+  if (!g_pendingKeys.isEmpty() && g_pendingKeys.find(key))
+  {
+    // this thread is computing the result, which stops the recursion
+    s->hits++;
+    info = LookupInfo();
+    return TRUE;
+  }
+  LookupCacheEntry *e = s->cache->find(key);
+  if (e && p->isStale(e))
+  {
+    s->remove(key);
+    e=0;
+  }
+  if (e==0)
+  {
+    s->misses++;
+    s->missed(h);
+    return FALSE;
+  }
+  if (e->pendingOwner)
+  {
+    // another thread is still computing the result
+    s->misses++;
+    return FALSE;
+  }
+  s->hits++;
+  info = e->info;
+  return TRUE;
+}
+
+void LookupCache::insert(const char *key,const LookupInfo &info)
+{
+  uint h = Private::hash(key);
+  LookupCacheShard *s = p->shards[(h>>16)&(numShards-1)];
+  QMutexLocker locker(&s->mutex);
+  g_pendingKeys.remove(key);
+  LookupCacheEntry *e = s->cache->find(key);
+  if (e==0)
+  {
+    e = new LookupCacheEntry(s,h,p->generation);
+    s->cache->insert(key,e);
+  }
+  else if (e->pendingOwner && e->pendingOwner!=&g_threadTag)
+  {
+    // both threads computed the same result, keep the first one
+    return;
+  }
+  e->info = info;
+  e->generation = p->generation;
+  e->pendingOwner = 0;
+}
+
+void LookupCache::insertPending(const char *key)
+{
+  uint h = Private::hash(key);
+  LookupCacheShard *s = p->shards[(h>>16)&(numShards-1)];
+  QMutexLocker locker(&s->mutex);
+  g_pendingKeys.insert(key,(void *)0x8);
+  LookupCacheEntry *e = s->cache->find(key);
+  if (e==0) // otherwise another thread is computing it too
+  {
+    e = new LookupCacheEntry(s,h,p->generation);
+    e->pendingOwner = &g_threadTag;
+    s->cache->insert(key,e);
+  }
+}
+
+void LookupCache::clear()
+{
+  int i;
+  for (i=0;i<numShards;i++)
+  {
+    LookupCacheShard *s = p->shards[i];
+    QMutexLocker locker(&s->mutex);
+    s->removing=TRUE;
+    s->cache->clear();
+    s->removing=FALSE;
+  }
+}
+
+void LookupCache::flushResolved()
+{
+  // entries are removed when they are found to be stale
+  p->lockAll();
+  p->resolvedValidFrom = ++p->generation;
+  p->unlockAll();
+}
+
+void LookupCache::flushUnresolved()
+{
+  p->lockAll();
+  p->unresolvedValidFrom = ++p->generation;
+  p->unlockAll();
+}
+
+uint LookupCache::count() const
+{
+  uint n=0;
+  int i;
+  for (i=0;i<numShards;i++)
+  {
+    QMutexLocker locker(&p->shards[i]->mutex);
+    n+=p->shards[i]->cache->count();
+  }
+  return n;
+}
+
+uint LookupCache::size() const
+{
+  uint n=0;
+  int i;
+  for (i=0;i<numShards;i++)
+  {
+    QMutexLocker locker(&p->shards[i]->mutex);
+    n+=(uint)p->shards[i]->cache->maxCost();
+  }
+  return n;
+}
+
+uint LookupCache::initialSize() const
+{
+  return p->initialSize;
+}
+
+uint LookupCache::neededSize() const
+{
+  // all shards start with the same size, so each one needs the size
+  // of the largest
+  uint n=0;
+  int i;
+  for (i=0;i<numShards;i++)
+  {
+    QMutexLocker locker(&p->shards[i]->mutex);
+    n=QMAX(n,(uint)p->shards[i]->cache->maxCost());
+  }
+  return n*numShards;
+}
+
+uint LookupCache::hits() const
+{
+  uint n=0;
+  int i;
+  for (i=0;i<numShards;i++)
+  {
+    QMutexLocker locker(&p->shards[i]->mutex);
+    n+=p->shards[i]->hits;
+  }
+  return n;
+}
+
+uint LookupCache::misses() const
+{
+  uint n=0;
+  int i;
+  for (i=0;i<numShards;i++)
+  {
+    QMutexLocker locker(&p->shards[i]->mutex);
+    n+=p->shards[i]->misses;
+  }
+  return n;
+}
@@ -0,0 +1,93 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#ifndef LOOKUPCACHE_H
+#define LOOKUPCACHE_H
+
+#include <qcstring.h>
+
+class ClassDef;
+class MemberDef;
+
+/** Result of resolving a class name in a scope, see getResolvedClass() */
+struct LookupInfo
+{
+  LookupInfo() : classDef(0), typeDef(0) {}
+  LookupInfo(const ClassDef *cd,const MemberDef *td,QCString ts,QCString rt)
+    : classDef(cd), typeDef(td), templSpec(ts),resolvedType(rt) {}
+  const ClassDef  *classDef;
+  const MemberDef *typeDef;
+  QCString   templSpec;
+  QCString   resolvedType;
+};
+
+/** @brief Cache of the results of getResolvedClass().
+ *
+ *  The cache is split into shards, each with its own lock and least
+ *  recently used list, so it can be used from multiple threads at once.
+ *  Results are copied in and out, so they stay valid when the entry is
+ *  evicted by another thread.
+ *
+ *  A shard grows when keys are looked up again shortly after they were
+ *  evicted, i.e. when the cache is too small for the working set, up to
+ *  a maximum size.
+ */
+class LookupCache
+{
+  public:
+    LookupCache(uint initialSize,uint maxSize);
+   ~LookupCache();
+
+    /** Looks up \a key. Returns TRUE and sets \a info if it was found. */
+    bool find(const char *key,LookupInfo &info);
+
+    /** Stores \a info for \a key, replacing any previous result. */
+    void insert(const char *key,const LookupInfo &info);
+
+    /** Stores an empty result for \a key, to stop recursive lookups of the
+     *  same key while the result is being computed. The empty result is only
+     *  visible to the calling thread, until it is replaced using insert().
+     *  This also holds when another thread is computing the same key.
+     */
+    void insertPending(const char *key);
+
+    /** Removes all results */
+    void clear();
+
+    /** Removes all results that found a class */
+    void flushResolved();
+
+    /** Removes all results that found neither a class nor a typedef */
+    void flushUnresolved();
+
+    uint count() const;
+    uint size() const;
+    uint initialSize() const;
+
+    /** Returns the initial size that would have been needed to avoid
+     *  growing any of the shards.
+     */
+    uint neededSize() const;
+    uint hits() const;
+    uint misses() const;
+
+  private:
+    LookupCache(const LookupCache &);
+    LookupCache &operator=(const LookupCache &);
+    struct Private;
+    Private *p;
+};
+
+#endif
@@ -51,6 +51,7 @@
 #include "config.h"
 #include "section.h"
 #include "message.h"
+#include "parseorder.h"
 
 //-----------
 
@@ -102,12 +103,13 @@ enum Alignment { AlignNone, AlignLeft, AlignCenter, AlignRight };
 
 //----------
 
-static QDict<LinkRef> g_linkRefs(257);
-static action_t       g_actions[256];
-static Entry         *g_current;
-static QCString       g_fileName;
-static int            g_lineNr;
-static int            g_indentLevel=0;  // 0 is outside markdown, -1=page level
+// the state of the text being processed, each thread has its own
+static action_t                     g_actions[256];
+static thread_local QDict<LinkRef>  g_linkRefs(257);
+static thread_local Entry          *g_current;
+static thread_local QCString        g_fileName;
+static thread_local int             g_lineNr;
+static thread_local int             g_indentLevel=0;  // 0 is outside markdown, -1=page level
 
 //----------
 
@@ -1290,6 +1292,7 @@ static QCString extractTitleId(QCString &title, int level)
   if ((level > 0) && (level <= Config_getInt(TOC_INCLUDE_HEADINGS)))
   {
     static int autoId = 0;
+    ParseOrder::waitForTurn(); // number the ids in input order
     QCString id;
     id.sprintf("autotoc_md%d",autoId++);
     //printf("auto-generated id='%s' title='%s'\n",id.data(),title.data());
@@ -2519,32 +2522,34 @@ static QCString detab(const QCString &s,int &refIndent)
 
 //---------------------------------------------------------------------------
 
+static bool initActions()
+{
+  // setup callback table for special characters
+  g_actions[(unsigned int)'_']=processEmphasis;
+  g_actions[(unsigned int)'*']=processEmphasis;
+  g_actions[(unsigned int)'~']=processEmphasis;
+  g_actions[(unsigned int)'`']=processCodeSpan;
+  g_actions[(unsigned int)'\\']=processSpecialCommand;
+  g_actions[(unsigned int)'@']=processSpecialCommand;
+  g_actions[(unsigned int)'[']=processLink;
+  g_actions[(unsigned int)'!']=processLink;
+  g_actions[(unsigned int)'<']=processHtmlTag;
+  g_actions[(unsigned int)'-']=processNmdash;
+  g_actions[(unsigned int)'"']=processQuoted;
+  return TRUE;
+}
+
 QCString processMarkdown(const QCString &fileName,const int lineNr,Entry *e,const QCString &input)
 {
-  static bool init=FALSE;
-  if (!init)
-  {
-    // setup callback table for special characters
-    g_actions[(unsigned int)'_']=processEmphasis;
-    g_actions[(unsigned int)'*']=processEmphasis;
-    g_actions[(unsigned int)'~']=processEmphasis;
-    g_actions[(unsigned int)'`']=processCodeSpan;
-    g_actions[(unsigned int)'\\']=processSpecialCommand;
-    g_actions[(unsigned int)'@']=processSpecialCommand;
-    g_actions[(unsigned int)'[']=processLink;
-    g_actions[(unsigned int)'!']=processLink;
-    g_actions[(unsigned int)'<']=processHtmlTag;
-    g_actions[(unsigned int)'-']=processNmdash;
-    g_actions[(unsigned int)'"']=processQuoted;
-    init=TRUE;
-  }
+  static bool init=initActions(); // done once, also when called on several threads
+  (void)init;
 
   g_linkRefs.setAutoDelete(TRUE);
   g_linkRefs.clear();
   g_current = e;
   g_fileName = fileName;
   g_lineNr   = lineNr;
-  static GrowBuf out;
+  static thread_local GrowBuf out;
   if (input.isEmpty()) return input;
   out.clear();
   int refIndent;
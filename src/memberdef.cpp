@@ -203,7 +203,7 @@ class MemberDefImpl : public DefinitionImpl, public MemberDef
     virtual ExampleSDict *getExamples() const;
     virtual bool isPrototype() const;
     virtual const ArgumentList *argumentList() const;
-    virtual ArgumentList *argumentList();
+    virtual ArgumentList *writableArgumentList();
     virtual const ArgumentList *declArgumentList() const;
     virtual const ArgumentList *templateArguments() const;
     virtual const QList<ArgumentList> *definitionTemplateParameterLists() const;
@@ -351,6 +351,9 @@ class MemberDefImpl : public DefinitionImpl, public MemberDef
 
     static int s_indentLevel;
 
+    friend void getMemberDefStorageStats(uint &numMembers,uint &numWithColdData,
+                                         uint &memberSize,uint &coldDataSize);
+
     // disable copying of member defs
     MemberDefImpl(const MemberDefImpl &);
     MemberDefImpl &operator=(const MemberDefImpl &);
@@ -747,8 +750,8 @@ class MemberDefAliasImpl : public DefinitionAliasImpl, public MemberDef
     { err("non-const getNamespaceDef() called on aliased member. Please report as a bug.\n"); return 0; }
     virtual GroupDef *getGroupDef()
     { err("non-const getGroupDef() called on aliased member. Please report as a bug.\n"); return 0; }
-    virtual ArgumentList *argumentList()
-    { err("non-const argumentList() called on aliased member. Please report as bug.\n"); return 0; }
+    virtual ArgumentList *writableArgumentList()
+    { err("writableArgumentList() called on aliased member. Please report as bug.\n"); return 0; }
 
     virtual void setEnumBaseType(const QCString &type) {}
     virtual void setMemberType(MemberType t) {}
@@ -1301,13 +1304,69 @@ class MemberDefImpl::IMPL
               const ArgumentList *al,const char *meta
              );
 
+    /** Data that only few members have, such as properties, enum values,
+     *  template instances, Objective-C categories and members from tag files.
+     *  It is allocated when one of its fields is set for the first time.
+     */
+    struct ColdData
+    {
+      ColdData() : accessorClass(0), enumScope(0), annEnumType(0),
+                   livesInsideEnum(FALSE), isTypedefValCached(FALSE),
+                   relatedAlso(0), templateMaster(0), groupAlias(0),
+                   groupStartLine(0), groupMember(0), cachedTypedefValue(0),
+                   docProvider(0), category(0), categoryRelation(0),
+                   numberOfFlowKW(0) {}
+      QCString accessorType;    // return type that tell how to get to this member
+      ClassDef *accessorClass;  // class that this member accesses (for anonymous types)
+      MemberDef  *enumScope;    // the enclosing scope, if this is an enum field
+      const MemberDef  *annEnumType;  // the anonymous enum that is the type of this member
+      bool livesInsideEnum;
+      bool isTypedefValCached;
+      ClassDef   *relatedAlso;  // points to class marked by relatedAlso
+      QCString read;            // property read accessor
+      QCString write;           // property write accessor
+      QCString exception;       // exceptions that can be thrown
+      QCString extraTypeChars;  // extra type info found after the argument list
+      QCString enumBaseType;    // base type of the enum (C++11)
+      MemberDef *templateMaster;
+      QCString metaData;        // Slice metadata.
+      const MemberDef *groupAlias;    // Member containing the definition
+      QCString groupFileName;   // file where this grouping was defined
+      int groupStartLine;       // line  "      "      "     "     "
+      MemberDef *groupMember;
+      const ClassDef *cachedTypedefValue;
+      QCString cachedTypedefTemplSpec;
+      QCString cachedResolvedType;
+      // documentation inheritance
+      MemberDef *docProvider;
+      // to store the output file base from tag files
+      QCString explicitOutputFileBase;
+      // objective-c
+      ClassDef *category;
+      MemberDef *categoryRelation;
+      int numberOfFlowKW;
+    };
+    //! returns the rarely used data, or the defaults if none has been set
+    const ColdData &cold() const
+    {
+      static const ColdData defaults;
+      return coldData ? *coldData : defaults;
+    }
+    //! returns the rarely used data for changing it
+    ColdData &writableCold()
+    {
+      if (coldData==0)
+      {
+        coldData = new ColdData;
+        s_numColdData++;
+      }
+      return *coldData;
+    }
+
     ClassDef     *classDef;   // member of or related to
     FileDef      *fileDef;    // member of file definition
     NamespaceDef *nspace;     // the namespace this member is in.
 
-    MemberDef  *enumScope;    // the enclosing scope, if this is an enum field
-    bool        livesInsideEnum;
-    const MemberDef  *annEnumType;  // the anonymous enum that is the type of this member
     MemberList *enumFields;   // enumeration fields
 
     MemberDef  *redefines;    // the members that this member redefines
@@ -1315,33 +1374,9 @@ class MemberDefImpl::IMPL
 
     MemberDef  *memDef;       // member definition for this declaration
     MemberDef  *memDec;       // member declaration for this definition
-    ClassDef   *relatedAlso;  // points to class marked by relatedAlso
 
     ExampleSDict *exampleSDict; // a dictionary of all examples for quick access
 
-    QCString type;            // return actual type
-    QCString accessorType;    // return type that tell how to get to this member
-    ClassDef *accessorClass;  // class that this member accesses (for anonymous types)
-    QCString args;            // function arguments/variable array specifiers
-    QCString def;             // member definition in code (fully qualified name)
-    QCString anc;             // HTML anchor name
-    Specifier virt;           // normal/virtual/pure virtual
-    Protection prot;          // protection type [Public/Protected/Private]
-    QCString decl;            // member declaration in class
-
-    QCString bitfields;       // struct member bitfields
-    QCString read;            // property read accessor
-    QCString write;           // property write accessor
-    QCString exception;       // exceptions that can be thrown
-    QCString initializer;     // initializer
-    QCString extraTypeChars;  // extra type info found after the argument list
-    QCString enumBaseType;    // base type of the enum (C++11)
-    int initLines;            // number of lines in the initializer
-
-    uint64  memSpec;          // The specifiers present for this member
-    MemberType mtype;         // returns the kind of member
-    int maxInitLines;         // when the initializer will be displayed
-    int userInitLines;        // result of explicit \hideinitializer or \showinitializer
     MemberDef  *annMemb;
 
     ArgumentList *defArgList;    // argument list of this member definition
@@ -1349,75 +1384,73 @@ class MemberDefImpl::IMPL
 
     ArgumentList *tArgList;      // template argument list of function template
     ArgumentList *typeConstraints; // type constraints for template parameters
-    MemberDef *templateMaster;
     QList<ArgumentList> *defTmpArgLists; // lists of template argument lists
                                          // (for template functions in nested template classes)
 
-    QCString metaData;        // Slice metadata.
-
     ClassDef *cachedAnonymousType; // if the member has an anonymous compound
                                    // as its type then this is computed by
                                    // getClassDefOfAnonymousType() and
                                    // cached here.
     SDict<MemberList> *classSectionSDict; // not accessible
 
-    const MemberDef *groupAlias;    // Member containing the definition
-    int grpId;                // group id
     MemberGroup *memberGroup; // group's member definition
     GroupDef *group;          // group in which this member is in
-    Grouping::GroupPri_t grouppri; // priority of this definition
-    QCString groupFileName;   // file where this grouping was defined
-    int groupStartLine;       // line  "      "      "     "     "
-    MemberDef *groupMember;
 
-    bool isTypedefValCached;
-    const ClassDef *cachedTypedefValue;
-    QCString cachedTypedefTemplSpec;
-    QCString cachedResolvedType;
+    ColdData *coldData;       // rarely used data, see cold()
 
-    // inbody documentation
-    //int inbodyLine;
-    //QCString inbodyFile;
-    //QCString inbodyDocs;
-
-    // documentation inheritance
-    MemberDef *docProvider;
-
-    // to store the output file base from tag files
-    QCString explicitOutputFileBase;
+    QCString type;            // return actual type
+    QCString args;            // function arguments/variable array specifiers
+    QCString def;             // member definition in code (fully qualified name)
+    QCString anc;             // HTML anchor name
+    QCString decl;            // member declaration in class
+    QCString bitfields;       // struct member bitfields
+    QCString initializer;     // initializer
+    QCString declFileName;
 
-    // objective-c
-    bool implOnly; // function found in implementation but not
-                     // in the interface
-    mutable bool hasDocumentedParams;
-    mutable bool hasDocumentedReturnType;
-    bool isDMember;
+    uint64  memSpec;          // The specifiers present for this member
+    Specifier virt;           // normal/virtual/pure virtual
+    Protection prot;          // protection type [Public/Protected/Private]
+    MemberType mtype;         // returns the kind of member
     Relationship related;     // relationship of this to the class
-    bool stat;                // is it a static function?
-    bool proto;               // is it a prototype;
-    bool docEnumValues;       // is an enum with documented enum values.
-
-    mutable bool annScope;    // member is part of an anonymous scope
-    mutable bool annUsed;     // ugly: needs to be mutable to allow setAnonymousUsed to act as a
-                              // const member.
-    bool hasCallGraph;
-    bool hasCallerGraph;
-    bool hasReferencedByRelation;
-    bool hasReferencesRelation;
-    bool explExt;             // member was explicitly declared external
-    bool tspec;               // member is a template specialization
-    bool groupHasDocs;        // true if the entry that caused the grouping was documented
-    bool docsForDefinition;   // TRUE => documentation block is put before
-                              //         definition.
-                              // FALSE => block is put before declaration.
-    ClassDef *category;
-    MemberDef *categoryRelation;
-    QCString declFileName;
+    Grouping::GroupPri_t grouppri; // priority of this definition
+    int initLines;            // number of lines in the initializer
+    int maxInitLines;         // when the initializer will be displayed
+    int userInitLines;        // result of explicit \hideinitializer or \showinitializer
+    int grpId;                // group id
     int declLine;
     int declColumn;
-    int numberOfFlowKW;
+
+    // objective-c
+    bool implOnly : 1;        // function found in implementation but not
+                              // in the interface
+    mutable bool hasDocumentedParams : 1;
+    mutable bool hasDocumentedReturnType : 1;
+    bool isDMember : 1;
+    bool stat : 1;            // is it a static function?
+    bool proto : 1;           // is it a prototype;
+    bool docEnumValues : 1;   // is an enum with documented enum values.
+
+    mutable bool annScope : 1;  // member is part of an anonymous scope
+    mutable bool annUsed : 1;   // ugly: needs to be mutable to allow setAnonymousUsed to act as a
+                                // const member.
+    bool hasCallGraph : 1;
+    bool hasCallerGraph : 1;
+    bool hasReferencedByRelation : 1;
+    bool hasReferencesRelation : 1;
+    bool explExt : 1;         // member was explicitly declared external
+    bool tspec : 1;           // member is a template specialization
+    bool groupHasDocs : 1;    // true if the entry that caused the grouping was documented
+    bool docsForDefinition : 1; // TRUE => documentation block is put before
+                                //         definition.
+                                // FALSE => block is put before declaration.
+
+    static uint s_numImpl;      // number of IMPL objects created
+    static uint s_numColdData;  // number of ColdData objects created
 };
 
+uint MemberDefImpl::IMPL::s_numImpl     = 0;
+uint MemberDefImpl::IMPL::s_numColdData = 0;
+
 MemberDefImpl::IMPL::IMPL() :
     enumFields(0),
     redefinedBy(0),
@@ -1428,12 +1461,11 @@ MemberDefImpl::IMPL::IMPL() :
     typeConstraints(0),
     defTmpArgLists(0),
     classSectionSDict(0),
-    category(0),
-    categoryRelation(0),
+    coldData(0),
     declLine(-1),
-    declColumn(-1),
-    numberOfFlowKW(0)
+    declColumn(-1)
 {
+  s_numImpl++;
 }
 
 MemberDefImpl::IMPL::~IMPL()
@@ -1441,12 +1473,22 @@ MemberDefImpl::IMPL::~IMPL()
   delete redefinedBy;
   delete exampleSDict;
   delete enumFields;
-  delete defArgList;
+  ArgumentList::release(defArgList);
   delete tArgList;
   delete typeConstraints;
   delete defTmpArgLists;
   delete classSectionSDict;
-  delete declArgList;
+  ArgumentList::release(declArgList);
+  delete coldData;
+}
+
+void getMemberDefStorageStats(uint &numMembers,uint &numWithColdData,
+                              uint &memberSize,uint &coldDataSize)
+{
+  numMembers      = MemberDefImpl::IMPL::s_numImpl;
+  numWithColdData = MemberDefImpl::IMPL::s_numColdData;
+  memberSize      = sizeof(MemberDefImpl)+sizeof(MemberDefImpl::IMPL);
+  coldDataSize    = sizeof(MemberDefImpl::IMPL::ColdData);
 }
 
 void MemberDefImpl::IMPL::init(Definition *def,
@@ -1459,9 +1501,7 @@ void MemberDefImpl::IMPL::init(Definition *def,
   classDef=0;
   fileDef=0;
   redefines=0;
-  relatedAlso=0;
   redefinedBy=0;
-  accessorClass=0;
   nspace=0;
   memDef=0;
   memDec=0;
@@ -1469,8 +1509,6 @@ void MemberDefImpl::IMPL::init(Definition *def,
   grpId=-1;
   exampleSDict=0;
   enumFields=0;
-  enumScope=0;
-  livesInsideEnum=FALSE;
   defTmpArgLists=0;
   hasCallGraph = FALSE;
   hasCallerGraph = FALSE;
@@ -1493,14 +1531,13 @@ void MemberDefImpl::IMPL::init(Definition *def,
   related=r;
   stat=s;
   mtype=mt;
-  exception=e;
+  if (mt==MemberType_Typedef) invalidateAccessCache(); // substTypedef() may now find it
+  if (e && *e) writableCold().exception=e;
   proto=FALSE;
   annScope=FALSE;
   memSpec=0;
   annMemb=0;
   annUsed=FALSE;
-  annEnumType=0;
-  groupAlias=0;
   explExt=FALSE;
   tspec=FALSE;
   cachedAnonymousType=0;
@@ -1517,10 +1554,10 @@ void MemberDefImpl::IMPL::init(Definition *def,
     tArgList=0;
   }
   //printf("new member al=%p\n",al);
-  // copy function definition arguments (if any)
+  // share function definition arguments (if any) with other members
   if (al)
   {
-    defArgList = al->deepCopy();
+    defArgList = al->pooledCopy();
   }
   else
   {
@@ -1529,8 +1566,11 @@ void MemberDefImpl::IMPL::init(Definition *def,
   // convert function declaration arguments (if any)
   if (!args.isEmpty())
   {
-    declArgList = new ArgumentList;
-    stringToArgumentList(args,declArgList,&extraTypeChars);
+    ArgumentList declAl;
+    QCString extraTypeChars;
+    stringToArgumentList(args,&declAl,&extraTypeChars);
+    declArgList = declAl.pooledCopy();
+    if (!extraTypeChars.isEmpty()) writableCold().extraTypeChars=extraTypeChars;
     //printf("setDeclArgList %s to %s const=%d\n",args.data(),
     //    argListToString(declArgList).data(),declArgList->constSpecifier);
   }
@@ -1538,18 +1578,13 @@ void MemberDefImpl::IMPL::init(Definition *def,
   {
     declArgList = 0;
   }
-  metaData = meta;
-  templateMaster = 0;
+  if (meta && *meta) writableCold().metaData = meta;
   classSectionSDict = 0;
   docsForDefinition = TRUE;
-  isTypedefValCached = FALSE;
-  cachedTypedefValue = 0;
   //inbodyLine = -1;
   implOnly=FALSE;
-  groupMember = 0;
   hasDocumentedParams = FALSE;
   hasDocumentedReturnType = FALSE;
-  docProvider = 0;
   isDMember = def->getDefFileName().right(2).lower()==".d";
 }
 
@@ -1619,7 +1654,12 @@ MemberDef *MemberDefImpl::deepCopy() const
   result->m_impl->defTmpArgLists=0;
   result->m_impl->classSectionSDict=0;
   result->m_impl->declArgList=0;
+  result->m_impl->coldData=0;
   // replace pointers owned by the object by deep copies
+  if (m_impl->coldData)
+  {
+    result->m_impl->writableCold() = *m_impl->coldData;
+  }
   if (m_impl->redefinedBy)
   {
     MemberListIterator mli(*m_impl->redefinedBy);
@@ -1649,7 +1689,8 @@ MemberDef *MemberDefImpl::deepCopy() const
   }
   if (m_impl->defArgList)
   {
-    result->m_impl->defArgList = m_impl->defArgList->deepCopy();
+    result->m_impl->defArgList = m_impl->defArgList->isPooled() ?
+                                 m_impl->defArgList : m_impl->defArgList->deepCopy();
   }
   if (m_impl->tArgList)
   {
@@ -1672,7 +1713,8 @@ MemberDef *MemberDefImpl::deepCopy() const
   }
   if (m_impl->declArgList)
   {
-    result->m_impl->declArgList = m_impl->declArgList->deepCopy();
+    result->m_impl->declArgList = m_impl->declArgList->isPooled() ?
+                                  m_impl->declArgList : m_impl->declArgList->deepCopy();
   }
   return result;
 }
@@ -1712,9 +1754,9 @@ void MemberDefImpl::setReimplements(MemberDef *md)
 
 void MemberDefImpl::insertReimplementedBy(MemberDef *md)
 {
-  if (m_impl->templateMaster)
+  if (m_impl->cold().templateMaster)
   {
-    m_impl->templateMaster->insertReimplementedBy(md);
+    m_impl->cold().templateMaster->insertReimplementedBy(md);
   }
   if (m_impl->redefinedBy==0) m_impl->redefinedBy = new MemberList(MemberListType_redefinedBy);
   if (m_impl->redefinedBy->findRef(md)==-1)
@@ -1793,15 +1835,15 @@ QCString MemberDefImpl::getOutputFileBase() const
   QCString baseName;
 
   //printf("Member: %s: templateMaster=%p group=%p classDef=%p nspace=%p fileDef=%p\n",
-  //    name().data(),m_impl->templateMaster,m_impl->group,m_impl->classDef,
+  //    name().data(),m_impl->cold().templateMaster,m_impl->group,m_impl->classDef,
   //    m_impl->nspace,m_impl->fileDef);
   const NamespaceDef *nspace = getNamespaceDef();
   const FileDef *fileDef = getFileDef();
   const ClassDef *classDef = getClassDef();
   const GroupDef *groupDef = getGroupDef();
-  if (!m_impl->explicitOutputFileBase.isEmpty())
+  if (!m_impl->cold().explicitOutputFileBase.isEmpty())
   {
-    return m_impl->explicitOutputFileBase;
+    return m_impl->cold().explicitOutputFileBase;
   }
   else if (templateMaster())
   {
@@ -1887,17 +1929,17 @@ QCString MemberDefImpl::getReference() const
 QCString MemberDefImpl::anchor() const
 {
   QCString result=m_impl->anc;
-  if (m_impl->groupAlias)     return m_impl->groupAlias->anchor();
-  if (m_impl->templateMaster) return m_impl->templateMaster->anchor();
-  if (m_impl->enumScope && m_impl->enumScope!=this) // avoid recursion for C#'s public enum E { E, F }
+  if (m_impl->cold().groupAlias)     return m_impl->cold().groupAlias->anchor();
+  if (m_impl->cold().templateMaster) return m_impl->cold().templateMaster->anchor();
+  if (m_impl->cold().enumScope && m_impl->cold().enumScope!=this) // avoid recursion for C#'s public enum E { E, F }
   {
-    result.prepend(m_impl->enumScope->anchor());
+    result.prepend(m_impl->cold().enumScope->anchor());
   }
   if (getGroupDef())
   {
-    if (m_impl->groupMember)
+    if (m_impl->cold().groupMember)
     {
-      result=m_impl->groupMember->anchor();
+      result=m_impl->cold().groupMember->anchor();
     }
     else if (getReference().isEmpty())
     {
@@ -2022,9 +2064,9 @@ bool MemberDefImpl::isLinkableInProject() const
 
 bool MemberDefImpl::isLinkable() const
 {
-  if (m_impl->templateMaster)
+  if (m_impl->cold().templateMaster)
   {
-    return m_impl->templateMaster->isLinkable();
+    return m_impl->cold().templateMaster->isLinkable();
   }
   else
   {
@@ -2054,9 +2096,9 @@ void MemberDefImpl::writeLink(OutputList &ol,
   const NamespaceDef *nspace = getNamespaceDef();
   if (!hideScopeNames)
   {
-    if (m_impl->enumScope && m_impl->livesInsideEnum)
+    if (m_impl->cold().enumScope && m_impl->cold().livesInsideEnum)
     {
-      n.prepend(m_impl->enumScope->displayName()+sep);
+      n.prepend(m_impl->cold().enumScope->displayName()+sep);
     }
     if (classDef && gd && !isRelated())
     {
@@ -2310,7 +2352,7 @@ void MemberDefImpl::writeDeclaration(OutputList &ol,
   ol.startMemberDeclaration();
 
   // start a new member declaration
-  bool isAnonymous = annoClassDef || m_impl->annMemb || m_impl->annEnumType;
+  bool isAnonymous = annoClassDef || m_impl->annMemb || m_impl->cold().annEnumType;
   ///printf("startMemberItem for %s\n",name().data());
   ol.startMemberItem(anchor(),
                      isAnonymous ? 1 : m_impl->tArgList ? 3 : 0,
@@ -3107,8 +3149,8 @@ void MemberDefImpl::_writeCategoryRelation(OutputList &ol) const
   {
     //printf("%s: category %s relation %s class=%s categoryOf=%s\n",
     //    name().data(),
-    //    m_impl->category ? m_impl->category->name().data() : "<none>",
-    //    m_impl->categoryRelation ? m_impl->categoryRelation->name().data() : "<none>",
+    //    m_impl->cold().category ? m_impl->cold().category->name().data() : "<none>",
+    //    m_impl->cold().categoryRelation ? m_impl->cold().categoryRelation->name().data() : "<none>",
     //    m_impl->classDef->name().data(),
     //    m_impl->classDef->categoryOf() ? m_impl->classDef->categoryOf()->name().data() : "<none>"
     //    );
@@ -3118,14 +3160,14 @@ void MemberDefImpl::_writeCategoryRelation(OutputList &ol) const
     QCString anc;
     QCString name;
     int i=-1;
-    if (m_impl->categoryRelation && m_impl->categoryRelation->isLinkable())
+    if (m_impl->cold().categoryRelation && m_impl->cold().categoryRelation->isLinkable())
     {
-      if (m_impl->category)
+      if (m_impl->cold().category)
       {
         // this member is in a normal class and implements method categoryRelation from category
         // so link to method 'categoryRelation' with 'provided by category 'category' text.
         text = theTranslator->trProvidedByCategory();
-        name = m_impl->category->displayName();
+        name = m_impl->cold().category->displayName();
       }
       else if (getClassDef()->categoryOf())
       {
@@ -3137,7 +3179,7 @@ void MemberDefImpl::_writeCategoryRelation(OutputList &ol) const
       i=text.find("@0");
       if (i!=-1)
       {
-        MemberDef *md = m_impl->categoryRelation;
+        MemberDef *md = m_impl->cold().categoryRelation;
         ref  = md->getReference();
         file = md->getOutputFileBase();
         anc  = md->anchor();
@@ -3258,9 +3300,9 @@ QCString MemberDefImpl::displayDefinition() const
     if (title.at(0)=='@')
     {
       ldef = title = "anonymous enum";
-      if (!m_impl->enumBaseType.isEmpty())
+      if (!m_impl->cold().enumBaseType.isEmpty())
       {
-        ldef+=" : "+m_impl->enumBaseType;
+        ldef+=" : "+m_impl->cold().enumBaseType;
       }
     }
     else
@@ -3439,9 +3481,9 @@ void MemberDefImpl::writeDocumentation(const MemberList *ml,
     if (title.at(0)=='@')
     {
       ldef = title = "anonymous enum";
-      if (!m_impl->enumBaseType.isEmpty())
+      if (!m_impl->cold().enumBaseType.isEmpty())
       {
-        ldef+=" : "+m_impl->enumBaseType;
+        ldef+=" : "+m_impl->cold().enumBaseType;
       }
     }
     else
@@ -3533,10 +3575,10 @@ void MemberDefImpl::writeDocumentation(const MemberList *ml,
     ol.startDoxyAnchor(cfname,cname,memAnchor,doxyName,doxyArgs);
     ol.startMemberDoc(ciname,name(),memAnchor,title,memCount,memTotal,showInline);
 
-    if (!m_impl->metaData.isEmpty() && getLanguage()==SrcLangExt_Slice)
+    if (!m_impl->cold().metaData.isEmpty() && getLanguage()==SrcLangExt_Slice)
     {
       ol.startMemberDocPrefixItem();
-      ol.docify(m_impl->metaData);
+      ol.docify(m_impl->cold().metaData);
       ol.endMemberDocPrefixItem();
     }
 
@@ -3775,12 +3817,13 @@ void MemberDefImpl::writeDocumentation(const MemberList *ml,
 
   QCString brief           = briefDescription();
   QCString detailed        = documentation();
-  ArgumentList *docArgList = m_impl->defArgList;
-  if (m_impl->templateMaster)
+  const ArgumentList *docArgList = m_impl->defArgList;
+  if (m_impl->cold().templateMaster)
   {
-    brief      = m_impl->templateMaster->briefDescription();
-    detailed   = m_impl->templateMaster->documentation();
-    docArgList = m_impl->templateMaster->argumentList();
+    const MemberDef *templateMaster = m_impl->cold().templateMaster;
+    brief      = templateMaster->briefDescription();
+    detailed   = templateMaster->documentation();
+    docArgList = templateMaster->argumentList();
   }
 
   /* write brief description */
@@ -3957,7 +4000,7 @@ static Definition *getClassFromType(Definition *scope,const QCString &type,SrcLa
 
 QCString MemberDefImpl::fieldType() const
 {
-  QCString type = m_impl->accessorType;
+  QCString type = m_impl->cold().accessorType;
   if (type.isEmpty())
   {
     type = m_impl->type;
@@ -3981,7 +4024,7 @@ void MemberDefImpl::writeMemberDocSimple(OutputList &ol, const Definition *conta
     doxyName="__unnamed__";
   }
 
-  ClassDef *cd = m_impl->accessorClass;
+  ClassDef *cd = m_impl->cold().accessorClass;
   //printf("===> %s::anonymous: %s\n",name().data(),cd?cd->name().data():"<none>");
 
   if (container && container->definitionType()==Definition::TypeClass &&
@@ -4368,23 +4411,25 @@ void MemberDefImpl::setGroupDef(GroupDef *gd,Grouping::GroupPri_t pri,
   //printf("%s MemberDefImpl::setGroupDef(%s)\n",name().data(),gd->name().data());
   m_impl->group=gd;
   m_impl->grouppri=pri;
-  m_impl->groupFileName=fileName;
-  m_impl->groupStartLine=startLine;
+  IMPL::ColdData &cold = m_impl->writableCold();
+  cold.groupFileName=fileName;
+  cold.groupStartLine=startLine;
   m_impl->groupHasDocs=hasDocs;
-  m_impl->groupMember=member;
+  cold.groupMember=member;
   m_isLinkableCached = 0;
 }
 
 void MemberDefImpl::setEnumScope(MemberDef *md,bool livesInsideEnum)
 {
-  m_impl->enumScope=md;
-  m_impl->livesInsideEnum=livesInsideEnum;
+  IMPL::ColdData &cold = m_impl->writableCold();
+  cold.enumScope=md;
+  cold.livesInsideEnum=livesInsideEnum;
   if (md->getGroupDef())
   {
     m_impl->group=md->getGroupDef();
     m_impl->grouppri=md->getGroupPri();
-    m_impl->groupFileName=md->getGroupFileName();
-    m_impl->groupStartLine=md->getGroupStartLine();
+    cold.groupFileName=md->getGroupFileName();
+    cold.groupStartLine=md->getGroupStartLine();
     m_impl->groupHasDocs=md->getGroupHasDocs();
     m_isLinkableCached = 0;
   }
@@ -4435,7 +4480,7 @@ MemberDef *MemberDefImpl::createTemplateInstanceMember(
                        substituteTemplateArgumentsInString(m_impl->type,formalArgs,actualArgs),
                        methodName,
                        substituteTemplateArgumentsInString(m_impl->args,formalArgs,actualArgs),
-                       m_impl->exception, m_impl->prot,
+                       m_impl->cold().exception, m_impl->prot,
                        m_impl->virt, m_impl->stat, m_impl->related, m_impl->mtype, 0, 0, ""
                    );
   imd->setArgumentList(actualArgList);
@@ -4795,11 +4840,11 @@ void MemberDefImpl::writeEnumDeclaration(OutputList &typeDecl,
     }
     typeDecl.writeChar(' ');
   }
-  if (!m_impl->enumBaseType.isEmpty())
+  if (!m_impl->cold().enumBaseType.isEmpty())
   {
     typeDecl.writeChar(':');
     typeDecl.writeChar(' ');
-    typeDecl.docify(m_impl->enumBaseType);
+    typeDecl.docify(m_impl->cold().enumBaseType);
     typeDecl.writeChar(' ');
   }
 
@@ -4881,13 +4926,13 @@ void MemberDefImpl::writeEnumDeclaration(OutputList &typeDecl,
 
 void MemberDefImpl::setArgumentList(ArgumentList *al)
 {
-  if (m_impl->defArgList) delete m_impl->defArgList;
+  ArgumentList::release(m_impl->defArgList);
   m_impl->defArgList = al;
 }
 
 void MemberDefImpl::setDeclArgumentList(ArgumentList *al)
 {
-  if (m_impl->declArgList) delete m_impl->declArgList;
+  ArgumentList::release(m_impl->declArgList);
   m_impl->declArgList = al;
 }
 
@@ -4912,13 +4957,13 @@ void MemberDefImpl::setType(const char *t)
 
 void MemberDefImpl::setAccessorType(ClassDef *cd,const char *t)
 {
-  m_impl->accessorClass = cd;
-  m_impl->accessorType = t;
+  m_impl->writableCold().accessorClass = cd;
+  m_impl->writableCold().accessorType = t;
 }
 
 ClassDef *MemberDefImpl::accessorClass() const
 {
-  return m_impl->accessorClass;
+  return m_impl->cold().accessorClass;
 }
 
 void MemberDefImpl::findSectionsInDocumentation()
@@ -4995,9 +5040,9 @@ QCString MemberDefImpl::qualifiedName() const
     qm+="]";
     return qm;
   }
-  else if (m_impl->enumScope && m_impl->enumScope->isStrong())
+  else if (m_impl->cold().enumScope && m_impl->cold().enumScope->isStrong())
   {
-    return m_impl->enumScope->qualifiedName()+
+    return m_impl->cold().enumScope->qualifiedName()+
            getLanguageSpecificSeparator(getLanguage())+
            localName();
   }
@@ -5014,7 +5059,7 @@ void MemberDefImpl::setTagInfo(TagInfo *ti)
     //printf("%s: Setting tag name=%s anchor=%s\n",name().data(),ti->tagName.data(),ti->anchor.data());
     m_impl->anc=ti->anchor;
     setReference(ti->tagName);
-    m_impl->explicitOutputFileBase = stripExtension(ti->fileName);
+    m_impl->writableCold().explicitOutputFileBase = stripExtension(ti->fileName);
   }
 }
 
@@ -5047,7 +5092,7 @@ const char *MemberDefImpl::definition() const
 
 const char *MemberDefImpl::extraTypeChars() const
 {
-  return m_impl->extraTypeChars;
+  return m_impl->cold().extraTypeChars;
 }
 
 const char *MemberDefImpl::typeString() const
@@ -5062,7 +5107,7 @@ const char *MemberDefImpl::argsString() const
 
 const char *MemberDefImpl::excpString() const
 {
-  return m_impl->exception;
+  return m_impl->cold().exception;
 }
 
 const char *MemberDefImpl::bitfieldString() const
@@ -5117,12 +5162,12 @@ NamespaceDef* MemberDefImpl::getNamespaceDef()
 
 const char *MemberDefImpl::getReadAccessor() const
 {
-  return m_impl->read;
+  return m_impl->cold().read;
 }
 
 const char *MemberDefImpl::getWriteAccessor() const
 {
-  return m_impl->write;
+  return m_impl->cold().write;
 }
 
 const GroupDef *MemberDefImpl::getGroupDef() const
@@ -5142,12 +5187,12 @@ Grouping::GroupPri_t MemberDefImpl::getGroupPri() const
 
 const char *MemberDefImpl::getGroupFileName() const
 {
-  return m_impl->groupFileName;
+  return m_impl->cold().groupFileName;
 }
 
 int MemberDefImpl::getGroupStartLine() const
 {
-  return m_impl->groupStartLine;
+  return m_impl->cold().groupStartLine;
 }
 
 bool MemberDefImpl::getGroupHasDocs() const
@@ -5398,8 +5443,8 @@ bool MemberDefImpl::isStrong() const
 bool MemberDefImpl::isStrongEnumValue() const
 {
   return m_impl->mtype==MemberType_EnumValue &&
-         m_impl->enumScope &&
-         m_impl->enumScope->isStrong();
+         m_impl->cold().enumScope &&
+         m_impl->cold().enumScope->isStrong();
 }
 
 bool MemberDefImpl::isUnretained() const
@@ -5504,7 +5549,7 @@ bool MemberDefImpl::showInCallGraph() const
 
 ClassDef *MemberDefImpl::relatedAlso() const
 {
-  return m_impl->relatedAlso;
+  return m_impl->cold().relatedAlso;
 }
 
 bool MemberDefImpl::hasDocumentedEnumValues() const
@@ -5514,7 +5559,7 @@ bool MemberDefImpl::hasDocumentedEnumValues() const
 
 const MemberDef *MemberDefImpl::getAnonymousEnumType() const
 {
-  return m_impl->annEnumType;
+  return m_impl->cold().annEnumType;
 }
 
 bool MemberDefImpl::isDocsForDefinition() const
@@ -5524,12 +5569,12 @@ bool MemberDefImpl::isDocsForDefinition() const
 
 const MemberDef *MemberDefImpl::getEnumScope() const
 {
-  return m_impl->enumScope;
+  return m_impl->cold().enumScope;
 }
 
 bool MemberDefImpl::livesInsideEnum() const
 {
-  return m_impl->livesInsideEnum;
+  return m_impl->cold().livesInsideEnum;
 }
 
 bool MemberDefImpl::isSliceLocal() const
@@ -5562,8 +5607,13 @@ const ArgumentList *MemberDefImpl::argumentList() const
   return m_impl->defArgList;
 }
 
-ArgumentList *MemberDefImpl::argumentList()
+ArgumentList *MemberDefImpl::writableArgumentList()
 {
+  // the caller may modify the list, so detach it from the pool first
+  if (m_impl->defArgList && m_impl->defArgList->isPooled())
+  {
+    m_impl->defArgList = m_impl->defArgList->deepCopy();
+  }
   return m_impl->defArgList;
 }
 
@@ -5629,28 +5679,28 @@ bool MemberDefImpl::hasReferencesRelation() const
 
 MemberDef *MemberDefImpl::templateMaster() const
 {
-  return m_impl->templateMaster;
+  return m_impl->cold().templateMaster;
 }
 
 bool MemberDefImpl::isTypedefValCached() const
 {
-  return m_impl->isTypedefValCached;
+  return m_impl->cold().isTypedefValCached;
 }
 
 const ClassDef *MemberDefImpl::getCachedTypedefVal() const
 {
-  return m_impl->cachedTypedefValue;
+  return m_impl->cold().cachedTypedefValue;
 }
 
 QCString MemberDefImpl::getCachedTypedefTemplSpec() const
 {
-  return m_impl->cachedTypedefTemplSpec;
+  return m_impl->cold().cachedTypedefTemplSpec;
 }
 
 QCString MemberDefImpl::getCachedResolvedTypedef() const
 {
-  //printf("MemberDefImpl::getCachedResolvedTypedef()=%s m_impl=%p\n",m_impl->cachedResolvedType.data(),m_impl);
-  return m_impl->cachedResolvedType;
+  //printf("MemberDefImpl::getCachedResolvedTypedef()=%s m_impl=%p\n",m_impl->cold().cachedResolvedType.data(),m_impl);
+  return m_impl->cold().cachedResolvedType;
 }
 
 MemberDef *MemberDefImpl::memberDefinition() const
@@ -5665,12 +5715,12 @@ MemberDef *MemberDefImpl::memberDeclaration() const
 
 MemberDef *MemberDefImpl::inheritsDocsFrom() const
 {
-  return m_impl->docProvider;
+  return m_impl->cold().docProvider;
 }
 
 const MemberDef *MemberDefImpl::getGroupAlias() const
 {
-  return m_impl->groupAlias;
+  return m_impl->cold().groupAlias;
 }
 
 QCString MemberDefImpl::getDeclFileName() const
@@ -5741,12 +5791,12 @@ void MemberDefImpl::setMaxInitLines(int lines)
 
 void MemberDefImpl::setReadAccessor(const char *r)
 {
-  m_impl->read=r;
+  if ((r && *r) || m_impl->coldData) m_impl->writableCold().read=r;
 }
 
 void MemberDefImpl::setWriteAccessor(const char *w)
 {
-  m_impl->write=w;
+  if ((w && *w) || m_impl->coldData) m_impl->writableCold().write=w;
 }
 
 void MemberDefImpl::setTemplateSpecialization(bool b)
@@ -5768,7 +5818,7 @@ void MemberDefImpl::makeForeign()
 
 void MemberDefImpl::setInheritsDocsFrom(MemberDef *md)
 {
-  m_impl->docProvider = md;
+  m_impl->writableCold().docProvider = md;
 }
 
 void MemberDefImpl::setArgsString(const char *as)
@@ -5778,7 +5828,7 @@ void MemberDefImpl::setArgsString(const char *as)
 
 void MemberDefImpl::setRelatedAlso(ClassDef *cd)
 {
-  m_impl->relatedAlso=cd;
+  m_impl->writableCold().relatedAlso=cd;
 }
 
 void MemberDefImpl::setEnumClassScope(ClassDef *cd)
@@ -5795,7 +5845,7 @@ void MemberDefImpl::setDocumentedEnumValues(bool value)
 
 void MemberDefImpl::setAnonymousEnumType(const MemberDef *md)
 {
-  m_impl->annEnumType = md;
+  m_impl->writableCold().annEnumType = md;
 }
 
 void MemberDefImpl::setPrototype(bool p,const QCString &df,int line,int column)
@@ -5859,7 +5909,7 @@ MemberDef *MemberDefImpl::fromAnonymousMember() const
 
 void MemberDefImpl::setTemplateMaster(MemberDef *mt)
 {
-  m_impl->templateMaster=mt;
+  m_impl->writableCold().templateMaster=mt;
   m_isLinkableCached = 0;
 }
 
@@ -5870,12 +5920,12 @@ void MemberDefImpl::setDocsForDefinition(bool b)
 
 void MemberDefImpl::setGroupAlias(const MemberDef *md)
 {
-  m_impl->groupAlias = md;
+  m_impl->writableCold().groupAlias = md;
 }
 
 void MemberDefImpl::invalidateTypedefValCache()
 {
-  m_impl->isTypedefValCached=FALSE;
+  if (m_impl->coldData) m_impl->coldData->isTypedefValCached=FALSE;
 }
 
 void MemberDefImpl::setMemberDefinition(MemberDef *md)
@@ -5890,42 +5940,43 @@ void MemberDefImpl::setMemberDeclaration(MemberDef *md)
 
 ClassDef *MemberDefImpl::category() const
 {
-  return m_impl->category;
+  return m_impl->cold().category;
 }
 
 void MemberDefImpl::setCategory(ClassDef *def)
 {
-  m_impl->category = def;
+  m_impl->writableCold().category = def;
 }
 
 MemberDef *MemberDefImpl::categoryRelation() const
 {
-  return m_impl->categoryRelation;
+  return m_impl->cold().categoryRelation;
 }
 
 void MemberDefImpl::setCategoryRelation(MemberDef *md)
 {
-  m_impl->categoryRelation = md;
+  m_impl->writableCold().categoryRelation = md;
 }
 
 void MemberDefImpl::setEnumBaseType(const QCString &type)
 {
-  m_impl->enumBaseType = type;
+  if (!type.isEmpty() || m_impl->coldData) m_impl->writableCold().enumBaseType = type;
 }
 
 QCString MemberDefImpl::enumBaseType() const
 {
-  return m_impl->enumBaseType;
+  return m_impl->cold().enumBaseType;
 }
 
 
 void MemberDefImpl::cacheTypedefVal(const ClassDef*val, const QCString & templSpec, const QCString &resolvedType)
 {
-  m_impl->isTypedefValCached=TRUE;
-  m_impl->cachedTypedefValue=val;
-  m_impl->cachedTypedefTemplSpec=templSpec;
-  m_impl->cachedResolvedType=resolvedType;
-  //printf("MemberDefImpl::cacheTypedefVal=%s m_impl=%p\n",m_impl->cachedResolvedType.data(),m_impl);
+  IMPL::ColdData &cold = m_impl->writableCold();
+  cold.isTypedefValCached=TRUE;
+  cold.cachedTypedefValue=val;
+  cold.cachedTypedefTemplSpec=templSpec;
+  cold.cachedResolvedType=resolvedType;
+  //printf("MemberDefImpl::cacheTypedefVal=%s m_impl=%p\n",m_impl->cold().cachedResolvedType.data(),m_impl);
 }
 
 void MemberDefImpl::copyArgumentNames(MemberDef *bmd)
@@ -5934,6 +5985,10 @@ void MemberDefImpl::copyArgumentNames(MemberDef *bmd)
     const ArgumentList *arguments = bmd->argumentList();
     if (m_impl->defArgList && arguments)
     {
+      if (m_impl->defArgList->isPooled())
+      {
+        m_impl->defArgList = m_impl->defArgList->deepCopy();
+      }
       ArgumentListIterator aliDst(*m_impl->defArgList);
       ArgumentListIterator aliSrc(*arguments);
       Argument *argDst;
@@ -5949,6 +6004,10 @@ void MemberDefImpl::copyArgumentNames(MemberDef *bmd)
     const ArgumentList *arguments = bmd->declArgumentList();
     if (m_impl->declArgList && arguments)
     {
+      if (m_impl->declArgList->isPooled())
+      {
+        m_impl->declArgList = m_impl->declArgList->deepCopy();
+      }
       ArgumentListIterator aliDst(*m_impl->declArgList);
       ArgumentListIterator aliSrc(*arguments);
       Argument *argDst;
@@ -5964,7 +6023,8 @@ void MemberDefImpl::copyArgumentNames(MemberDef *bmd)
 
 static void invalidateCachedTypesInArgumentList(ArgumentList *al)
 {
-  if (al)
+  // pooled lists only cache the canonical types of builtin types, which never change
+  if (al && !al->isPooled())
   {
     ArgumentListIterator ali(*al);
     Argument *a;
@@ -5983,12 +6043,12 @@ void MemberDefImpl::invalidateCachedArgumentTypes()
 
 void MemberDefImpl::incrementFlowKeyWordCount()
 {
-  m_impl->numberOfFlowKW++;
+  m_impl->writableCold().numberOfFlowKW++;
 }
 
 int MemberDefImpl::numberOfFlowKeyWords() const
 {
-  return m_impl->numberOfFlowKW;
+  return m_impl->cold().numberOfFlowKW;
 }
 
 //----------------
@@ -6066,14 +6126,16 @@ void combineDeclarationAndDefinition(MemberDef *mdec,MemberDef *mdef)
 
     const MemberDef *cmdec = const_cast<const MemberDef*>(mdec);
     const MemberDef *cmdef = const_cast<const MemberDef*>(mdef);
-    ArgumentList *mdefAl = mdef->argumentList();
-    ArgumentList *mdecAl = mdec->argumentList();
-    if (matchArguments2(cmdef->getOuterScope(),cmdef->getFileDef(),mdefAl,
-                        cmdec->getOuterScope(),cmdec->getFileDef(),mdecAl,
+    if (matchArguments2(cmdef->getOuterScope(),cmdef->getFileDef(),argumentListForMatching(mdef,mdec->argumentList()),
+                        cmdec->getOuterScope(),cmdec->getFileDef(),argumentListForMatching(mdec,mdef->argumentList()),
                         TRUE
                        )
        ) /* match found */
     {
+      // only take the lists for writing once they are known to match,
+      // since that gives members with a shared list their own copy
+      ArgumentList *mdefAl = mdef->writableArgumentList();
+      ArgumentList *mdecAl = mdec->writableArgumentList();
       //printf("Found member %s: definition in %s (doc='%s') and declaration in %s (doc='%s')\n",
       //    mn->memberName(),
       //    mdef->getFileDef()->name().data(),mdef->documentation().data(),
@@ -6188,9 +6250,9 @@ void combineDeclarationAndDefinition(MemberDef *mdec,MemberDef *mdef)
 
 QCString MemberDefImpl::briefDescription(bool abbr) const
 {
-  if (m_impl->templateMaster)
+  if (m_impl->cold().templateMaster)
   {
-    return m_impl->templateMaster->briefDescription(abbr);
+    return m_impl->cold().templateMaster->briefDescription(abbr);
   }
   else
   {
@@ -6200,9 +6262,9 @@ QCString MemberDefImpl::briefDescription(bool abbr) const
 
 QCString MemberDefImpl::documentation() const
 {
-  if (m_impl->templateMaster)
+  if (m_impl->cold().templateMaster)
   {
-    return m_impl->templateMaster->documentation();
+    return m_impl->cold().templateMaster->documentation();
   }
   else
   {
@@ -6243,6 +6305,6 @@ bool MemberDefImpl::isRelatedOrFriend() const
 bool MemberDefImpl::isReference() const
 {
   return DefinitionImpl::isReference() ||
-         (m_impl->templateMaster && m_impl->templateMaster->isReference());
+         (m_impl->cold().templateMaster && m_impl->cold().templateMaster->isReference());
 }
 
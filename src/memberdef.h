@@ -222,7 +222,10 @@ class MemberDef : virtual public Definition
 
     // argument related members
     virtual const ArgumentList *argumentList() const = 0;
-    virtual ArgumentList *argumentList() = 0;
+    /*! Returns the argument list for changing it. A list shared with other
+     *  members is first replaced by a private copy.
+     */
+    virtual ArgumentList *writableArgumentList() = 0;
     virtual const ArgumentList *declArgumentList() const = 0;
     virtual const ArgumentList *templateArguments() const = 0;
     virtual const QList<ArgumentList> *definitionTemplateParameterLists() const = 0;
@@ -426,6 +429,13 @@ MemberDef *createMemberDef(const char *defFileName,int defLine,int defColumn,
 
 MemberDef *createMemberDefAlias(const Definition *newScope,const MemberDef *aliasMd);
 
+/** Returns the number of members created and how many of them needed the
+ *  storage for rarely used data, together with the size in bytes of a member
+ *  (excluding the Definition part) and of the rarely used data.
+ */
+void getMemberDefStorageStats(uint &numMembers,uint &numWithColdData,
+                              uint &memberSize,uint &coldDataSize);
+
 void combineDeclarationAndDefinition(MemberDef *mdec,MemberDef *mdef);
 
 #endif
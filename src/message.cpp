@@ -15,8 +15,10 @@
 
 #include <stdio.h>
 #include <qdatetime.h>
+#include <qmutex.h>
 #include "config.h"
 #include "util.h"
+#include "parseorder.h"
 #include "debug.h"
 #include "doxygen.h"
 #include "portable.h"
@@ -34,6 +36,9 @@ static const char *error_str = "error: ";
 //                            // 6 = $line,$file,$text
 
 static FILE *warnFile = stderr;
+static int warnCount = 0;
+// guards warnCount and the output, since the input parser threads may report errors
+static QMutex warnMutex;
 
 void initWarningFormat()
 {
@@ -108,6 +113,7 @@ void msg(const char *fmt, ...)
 {
   if (!Config_getBool(QUIET))
   {
+    QMutexLocker locker(&warnMutex);
     if (Debug::isFlagSet(Debug::Time))
     {
       printf("%.3f sec: ",((double)Doxygen::runningTime.elapsed())/1000.0);
@@ -121,6 +127,8 @@ void msg(const char *fmt, ...)
 
 static void format_warn(const char *file,int line,const char *text)
 {
+  // files parsed on several threads report their warnings in input order
+  ParseOrder::waitForTurn();
   QCString fileSubst = file==0 ? "<unknown>" : file;
   QCString lineSubst; lineSubst.setNum(line);
   QCString textSubst = text;
@@ -157,7 +165,11 @@ static void format_warn(const char *file,int line,const char *text)
   msgText += '\n';
 
   // print resulting message
-  fwrite(msgText.data(),1,msgText.length(),warnFile);
+  {
+    QMutexLocker locker(&warnMutex);
+    warnCount++;
+    fwrite(msgText.data(),1,msgText.length(),warnFile);
+  }
   if (warnAsError)
   {
     exit(1);
@@ -231,7 +243,11 @@ void warn_uncond(const char *fmt, ...)
 {
   va_list args;
   va_start(args, fmt);
-  vfprintf(warnFile, (QCString(warning_str) + fmt).data(), args);
+  {
+    QMutexLocker locker(&warnMutex);
+    warnCount++;
+    vfprintf(warnFile, (QCString(warning_str) + fmt).data(), args);
+  }
   va_end(args);
 }
 
@@ -239,7 +255,11 @@ void err(const char *fmt, ...)
 {
   va_list args;
   va_start(args, fmt);
-  vfprintf(warnFile, (QCString(error_str) + fmt).data(), args);
+  {
+    QMutexLocker locker(&warnMutex);
+    warnCount++;
+    vfprintf(warnFile, (QCString(error_str) + fmt).data(), args);
+  }
   va_end(args);
 }
 
@@ -251,6 +271,12 @@ extern void err_full(const char *file,int line,const char *fmt, ...)
   va_end(args);
 }
 
+int warningCount()
+{
+  QMutexLocker locker(&warnMutex);
+  return warnCount;
+}
+
 void printlex(int dbg, bool enter, const char *lexName, const char *fileName)
 {
   const char *enter_txt = "entering";
@@ -31,6 +31,8 @@ extern void warn_uncond(const char *fmt, ...);
 extern void err(const char *fmt, ...);
 extern void err_full(const char *file,int line,const char *fmt, ...);
 void initWarningFormat();
+/** Returns the number of warnings and errors reported so far. */
+int warningCount();
 
 extern void printlex(int dbg, bool enter, const char *lexName, const char *fileName);
 #endif
@@ -382,6 +382,7 @@ void NamespaceDefImpl::insertUsedFile(FileDef *fd)
 void NamespaceDefImpl::addInnerCompound(const Definition *d)
 {
   m_innerCompounds->append(d->localName(),d);
+  invalidateAccessCache(); // followPath() may now find the compound
   if (d->definitionType()==Definition::TypeNamespace)
   {
     insertNamespace(dynamic_cast<const NamespaceDef *>(d));
@@ -1213,6 +1214,7 @@ int NamespaceDefImpl::numDocMembers() const
 
 void NamespaceDefImpl::addUsingDirective(const NamespaceDef *nd)
 {
+  invalidateAccessCache();
   if (usingDirList==0)
   {
     usingDirList = new NamespaceSDict;
@@ -1232,6 +1234,7 @@ const NamespaceSDict *NamespaceDefImpl::getUsedNamespaces() const
 
 void NamespaceDefImpl::addUsingDeclaration(const Definition *d)
 {
+  invalidateAccessCache();
   if (usingDeclList==0)
   {
     usingDeclList = new SDict<Definition>(17);
@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#include <vector>
+
+#include <qmutex.h>
+#include <qwaitcondition.h>
+
+#include "parseorder.h"
+
+// the scope of the file the current thread works on
+static thread_local ParseOrder::Scope *g_currentScope = 0;
+
+struct ParseOrder::Private
+{
+  Private(int numFiles)
+  {
+    for (int i=0;i<NumSteps;i++)
+    {
+      done[i].resize(numFiles,false);
+      numDone[i]=0;
+    }
+  }
+  QMutex            mutex;
+  QWaitCondition    stepFinished;
+  std::vector<bool> done[NumSteps];
+  int               numDone[NumSteps]; //!< files before this index are done
+};
+
+ParseOrder::ParseOrder(int numFiles) : p(new Private(numFiles))
+{
+}
+
+ParseOrder::~ParseOrder()
+{
+  delete p;
+}
+
+void ParseOrder::wait(Step step,int index)
+{
+  QMutexLocker locker(&p->mutex);
+  while (p->numDone[step]<index)
+  {
+    p->stepFinished.wait(&p->mutex);
+  }
+}
+
+void ParseOrder::finish(Step step,int index)
+{
+  QMutexLocker locker(&p->mutex);
+  p->done[step][index]=true;
+  int n=p->numDone[step];
+  if (n==index)
+  {
+    int numFiles=(int)p->done[step].size();
+    while (n<numFiles && p->done[step][n]) n++;
+    p->numDone[step]=n;
+    p->stepFinished.wakeAll();
+  }
+}
+
+//---------------------------------------------------------------------------
+
+ParseOrder::Scope::Scope(ParseOrder &order,int index)
+  : m_order(&order), m_index(index), m_prev(g_currentScope)
+{
+  for (int i=0;i<NumSteps;i++)
+  {
+    m_turn[i]=FALSE;
+    m_finished[i]=FALSE;
+  }
+  g_currentScope=this;
+}
+
+ParseOrder::Scope::~Scope()
+{
+  for (int i=0;i<NumSteps;i++)
+  {
+    if (!m_finished[i]) m_order->finish((Step)i,m_index);
+  }
+  g_currentScope=m_prev;
+}
+
+void ParseOrder::waitForTurn(Step step)
+{
+  Scope *s = g_currentScope;
+  if (s==0 || s->m_turn[step] || s->m_finished[step]) return;
+  s->m_order->wait(step,s->m_index);
+  s->m_turn[step]=TRUE;
+}
+
+void ParseOrder::finishStep(Step step)
+{
+  Scope *s = g_currentScope;
+  if (s==0 || s->m_finished[step]) return;
+  s->m_order->finish(step,s->m_index);
+  s->m_finished[step]=TRUE;
+}
+
+bool ParseOrder::isBound()
+{
+  return g_currentScope!=0;
+}
+
+bool ParseOrder::hadTurn(Step step)
+{
+  Scope *s = g_currentScope;
+  return s && s->m_turn[step];
+}
@@ -0,0 +1,91 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#ifndef PARSEORDER_H
+#define PARSEORDER_H
+
+#include <qglobal.h>
+
+/** Lets several threads parse input files at the same time, while the
+ *  state that is shared by all files still changes in input order.
+ *
+ *  Each file is identified by its position in the input. A thread that
+ *  works on a file binds itself to it with a ParseOrder::Scope. Before the
+ *  thread reads or changes shared state, such as the section, formula and
+ *  member group dictionaries, it calls waitForTurn(). This blocks until
+ *  all files before it are done with the same step. The file then keeps
+ *  the turn until it finishes the step, so the shared state sees the files
+ *  in the same order as when they are processed one after the other.
+ *
+ *  Preprocessing and parsing have separate turns, so a file can be
+ *  preprocessed while an earlier file is still being parsed.
+ *
+ *  When the calling thread is not bound to a file, all methods return at
+ *  once, so code that calls them also works in a single threaded run.
+ */
+class ParseOrder
+{
+  public:
+    enum Step { Preprocess=0, Parse=1, NumSteps=2 };
+
+    /** Creates an order for \a numFiles files, numbered from 0. */
+    ParseOrder(int numFiles);
+   ~ParseOrder();
+
+    /** Binds the calling thread to a file for the lifetime of the scope.
+     *  When the scope ends, the file is done with all steps.
+     */
+    class Scope
+    {
+      public:
+        Scope(ParseOrder &order,int index);
+       ~Scope();
+      private:
+        Scope(const Scope &);
+        Scope &operator=(const Scope &);
+        friend class ParseOrder;
+        ParseOrder *m_order;
+        int         m_index;
+        bool        m_turn[NumSteps];
+        bool        m_finished[NumSteps];
+        Scope      *m_prev;
+    };
+
+    /** Blocks until the files before the file of the calling thread are
+     *  done with \a step.
+     */
+    static void waitForTurn(Step step=Parse);
+
+    /** Marks the file of the calling thread as done with \a step. */
+    static void finishStep(Step step);
+
+    /** Returns TRUE if the calling thread is bound to a file. */
+    static bool isBound();
+
+    /** Returns TRUE if the file of the calling thread waited for its
+     *  turn for \a step, i.e. it used state shared with other files.
+     */
+    static bool hadTurn(Step step=Parse);
+
+  private:
+    ParseOrder(const ParseOrder &);
+    ParseOrder &operator=(const ParseOrder &);
+    void wait(Step step,int index);
+    void finish(Step step,int index);
+    struct Private;
+    Private *p;
+};
+
+#endif
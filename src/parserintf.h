@@ -22,6 +22,8 @@
 #include <qstrlist.h>
 
 #include "types.h"
+#include "bufstr.h"
+#include "chunkedinput.h"
 
 class Entry;
 class FileDef;
@@ -71,6 +73,29 @@ class ParserInterface
                             bool sameTranslationUnit,
                             QStrList &filesInSameTranslationUnit) = 0;
 
+    /** Parses a single input file whose contents are produced while they
+     *  are being read from \a input. Parsers that can consume their input
+     *  in chunks can reimplement this, the default implementation reads
+     *  the complete input and passes it to parseInput().
+     *  The other parameters are as for parseInput().
+     */
+    virtual void parseInputStream(const char *fileName,
+                                  ChunkedInput &input,
+                                  Entry *root,
+                                  bool sameTranslationUnit,
+                                  QStrList &filesInSameTranslationUnit)
+    {
+      BufStr buf(4096);
+      char chunk[4096];
+      int n;
+      while ((n=input.read(chunk,sizeof(chunk)))>0)
+      {
+        buf.addArray(chunk,n);
+      }
+      buf.addChar('\0');
+      parseInput(fileName,buf.data(),root,sameTranslationUnit,filesInSameTranslationUnit);
+    }
+
     /** Returns TRUE if the language identified by \a extension needs
      *  the C preprocessor to be run before feed the result to the input
      *  parser.
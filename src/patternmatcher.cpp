@@ -0,0 +1,236 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#include <ctype.h>
+
+#include <qstrlist.h>
+#include <qregexp.h>
+#include <qvector.h>
+#include <qarray.h>
+
+#include "patternmatcher.h"
+
+// the fixed parts of the patterns are indexed by their first characters
+static const int indexChars = 3;
+static const int indexSize  = 4096;
+
+/** A compiled pattern */
+struct CompiledPattern
+{
+  CompiledPattern(const QCString &p,const QCString &v) : pattern(p), value(v), re(0) {}
+ ~CompiledPattern() { delete re; }
+  QCString pattern; //!< the pattern, in lower case if matching is case insensitive
+  QCString value;   //!< the part after the =
+  QCString key;     //!< longest fixed part of the pattern, used to index it
+  QRegExp *re;      //!< for patterns that cannot be matched by starMatch()
+};
+
+struct PatternMatcher::Private
+{
+  Private(bool cs) : caseSensitive(cs), index(indexSize)
+  {
+    patterns.setAutoDelete(TRUE);
+    index.fill(-1);
+  }
+  bool caseSensitive;
+  QVector<CompiledPattern> patterns;
+  QArray<int> unindexed;  //!< patterns that are matched against every name, in order
+  QArray<int> index;      //!< first entry for each hash value, or -1
+  QArray<int> entryNext;  //!< next entry with the same hash value, or -1
+  QArray<int> entryPat;   //!< pattern of the entry
+
+  inline char fold(char c) const
+  {
+    return caseSensitive ? c : (char)tolower((uchar)c);
+  }
+  inline int hash(const char *s) const
+  {
+    uint h=0;
+    int i;
+    for (i=0;i<indexChars;i++) h=h*131+(uchar)fold(s[i]);
+    return (int)(h%indexSize);
+  }
+  //! matches the pattern \a pat only consisting of fixed characters and *'s against \a s
+  bool starMatch(const char *pat,const char *s) const
+  {
+    const char *star=0, *retry=0;
+    while (*s)
+    {
+      if (*pat=='*')
+      {
+        while (*pat=='*') pat++;
+        star=pat;
+        retry=s;
+      }
+      else if (*pat && *pat==fold(*s))
+      {
+        pat++;
+        s++;
+      }
+      else if (star) // let the last * match one more character
+      {
+        pat=star;
+        s=++retry;
+      }
+      else
+      {
+        return FALSE;
+      }
+    }
+    while (*pat=='*') pat++;
+    return *pat==0;
+  }
+  bool matchPattern(int i,const char *name) const
+  {
+    const CompiledPattern *cp = patterns.at(i);
+    if (cp->re) return cp->re->match(name)!=-1;
+    return starMatch(cp->pattern.data(),name);
+  }
+  void addPattern(const QCString &pattern,const QCString &value)
+  {
+    int i = (int)patterns.size();
+    CompiledPattern *cp = new CompiledPattern(caseSensitive ? pattern : pattern.lower(),value);
+    patterns.resize(i+1);
+    patterns.insert(i,cp);
+    if (pattern.find('?')!=-1 || pattern.find('[')!=-1)
+    {
+      cp->re = new QRegExp(pattern,caseSensitive,TRUE);
+    }
+    else // find the longest fixed part
+    {
+      const char *s = cp->pattern.data();
+      const char *e;
+      while (*s)
+      {
+        while (*s=='*') s++;
+        e=s;
+        while (*e && *e!='*') e++;
+        if (e-s>(int)cp->key.length()) cp->key=QCString(s,(uint)(e-s));
+        s=e;
+      }
+    }
+    if ((int)cp->key.length()<indexChars)
+    {
+      int n = (int)unindexed.size();
+      unindexed.resize(n+1);
+      unindexed[n]=i;
+    }
+    else
+    {
+      int e = (int)entryPat.size();
+      int h = hash(cp->key.data());
+      entryPat.resize(e+1);
+      entryNext.resize(e+1);
+      entryPat[e]=i;
+      entryNext[e]=index[h];
+      index[h]=e;
+    }
+  }
+  //! returns TRUE if \a key is found at \a s
+  bool keyAt(const QCString &key,const char *s) const
+  {
+    const char *k = key.data();
+    while (*k && *s && *k==fold(*s)) k++,s++;
+    return *k==0;
+  }
+};
+
+PatternMatcher::PatternMatcher(const QStrList *patterns,bool caseSensitive,bool withValueOnly)
+  : p(new Private(caseSensitive))
+{
+  if (patterns==0) return;
+  QStrListIterator it(*patterns);
+  const char *s;
+  for (;(s=it.current());++it)
+  {
+    QCString pattern = s;
+    QCString value;
+    int i=pattern.find('=');
+    if (i!=-1)
+    {
+      value=pattern.mid(i+1);
+      pattern=pattern.left(i);
+    }
+    else if (withValueOnly)
+    {
+      continue;
+    }
+    if (!pattern.isEmpty())
+    {
+      p->addPattern(pattern,value);
+    }
+  }
+}
+
+PatternMatcher::~PatternMatcher()
+{
+  delete p;
+}
+
+bool PatternMatcher::isEmpty() const
+{
+  return p->patterns.size()==0;
+}
+
+bool PatternMatcher::match(const char *name) const
+{
+  return find(name,FALSE)!=-1;
+}
+
+int PatternMatcher::findFirst(const char *name) const
+{
+  return find(name,TRUE);
+}
+
+QCString PatternMatcher::value(int index) const
+{
+  const CompiledPattern *cp = p->patterns.at(index);
+  return cp ? cp->value : QCString();
+}
+
+int PatternMatcher::find(const char *name,bool first) const
+{
+  if (name==0) name="";
+  int best=-1;
+  uint i;
+  for (i=0;i<p->unindexed.size();i++)
+  {
+    if (p->matchPattern(p->unindexed[i],name))
+    {
+      best=p->unindexed[i];
+      break;
+    }
+  }
+  if (best!=-1 && !first) return best;
+  // the fixed part of a pattern has to appear somewhere in the name
+  const char *s = name;
+  int len = qstrlen(name);
+  for (;len>=indexChars;s++,len--)
+  {
+    int e;
+    for (e=p->index[p->hash(s)];e!=-1;e=p->entryNext[e])
+    {
+      int pi = p->entryPat[e];
+      if ((best==-1 || pi<best) &&
+          p->keyAt(p->patterns.at(pi)->key,s) &&
+          p->matchPattern(pi,name))
+      {
+        best=pi;
+        if (!first) return best;
+      }
+    }
+  }
+  return best;
+}
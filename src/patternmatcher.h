@@ -0,0 +1,68 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#ifndef PATTERNMATCHER_H
+#define PATTERNMATCHER_H
+
+#include <qcstring.h>
+
+class QStrList;
+
+/** @brief A list of wildcard patterns, compiled once to match many names.
+ *
+ *  Used for lists like FILE_PATTERNS, EXCLUDE_PATTERNS and FILTER_PATTERNS.
+ *  A name matches a pattern in the same way as it matches a wildcard QRegExp,
+ *  i.e. the pattern has to match the whole name.
+ *
+ *  Patterns using only \c * are indexed by their longest fixed part, so a
+ *  name is only compared to the patterns whose fixed part it contains.
+ *  Patterns using \c ? or \c [...] are matched with a precompiled QRegExp.
+ *
+ *  Matching does not modify the object, so it can be done from multiple threads.
+ */
+class PatternMatcher
+{
+  public:
+    /** Compiles the patterns in \a patterns (which may be 0).
+     *  For a pattern of the form \c pattern=value only the part before the
+     *  \c = is used. If \a withValueOnly is TRUE, patterns without a value
+     *  are ignored.
+     */
+    PatternMatcher(const QStrList *patterns,bool caseSensitive,bool withValueOnly=FALSE);
+   ~PatternMatcher();
+
+    /** Returns TRUE if there are no patterns to match. */
+    bool isEmpty() const;
+
+    /** Returns TRUE if \a name matches at least one of the patterns. */
+    bool match(const char *name) const;
+
+    /** Returns the index of the first pattern in the list that matches \a name,
+     *  or -1 if there is no such pattern.
+     */
+    int findFirst(const char *name) const;
+
+    /** Returns the value of the pattern at \a index returned by findFirst(). */
+    QCString value(int index) const;
+
+  private:
+    PatternMatcher(const PatternMatcher &);
+    PatternMatcher &operator=(const PatternMatcher &);
+    int find(const char *name,bool first) const;
+    struct Private;
+    Private *p;
+};
+
+#endif
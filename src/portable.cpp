@@ -9,12 +9,18 @@
 #include <stdlib.h>
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <dirent.h>
+#include <fcntl.h>
 #include <errno.h>
 extern char **environ;
 #endif
 
 #include <qglobal.h>
 #include <qdatetime.h>
+#include <qstrlist.h>
 
 #if defined(_MSC_VER) || defined(__BORLANDC__)
 #define popen _popen
@@ -478,3 +484,141 @@ void portable_unlink(const char *fileName)
 #endif
 }
 
+
+/** Maps the contents of file \a fileName read-only into memory.
+ *  Returns a pointer to the contents and sets \a size to its length,
+ *  or returns 0 if the file could not be mapped (for instance because it is empty).
+ *  @see portable_unmapFile()
+ */
+const char *portable_mapFile(const char *fileName,uint &size)
+{
+  size=0;
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  HANDLE file = CreateFileA(fileName,GENERIC_READ,FILE_SHARE_READ,NULL,
+                            OPEN_EXISTING,FILE_ATTRIBUTE_NORMAL,NULL);
+  if (file==INVALID_HANDLE_VALUE) return 0;
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file,&fileSize) || fileSize.QuadPart<=0 ||
+      fileSize.QuadPart>=0x7fffffff)
+  {
+    CloseHandle(file);
+    return 0;
+  }
+  HANDLE mapping = CreateFileMappingA(file,NULL,PAGE_READONLY,0,0,NULL);
+  CloseHandle(file);
+  if (mapping==NULL) return 0;
+  void *data = MapViewOfFile(mapping,FILE_MAP_READ,0,0,0);
+  CloseHandle(mapping); // the view keeps the mapping alive
+  if (data==NULL) return 0;
+  size=(uint)fileSize.QuadPart;
+  return (const char *)data;
+#else
+  int fd = open(fileName,O_RDONLY);
+  if (fd==-1) return 0;
+  struct stat st;
+  if (fstat(fd,&st)==-1 || !S_ISREG(st.st_mode) || st.st_size<=0 ||
+      st.st_size>=0x7fffffff)
+  {
+    close(fd);
+    return 0;
+  }
+  void *data = mmap(0,(size_t)st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+  close(fd); // the mapping stays valid after closing the file
+  if (data==MAP_FAILED) return 0;
+#if defined(MADV_SEQUENTIAL)
+  madvise(data,(size_t)st.st_size,MADV_SEQUENTIAL);
+#endif
+  size=(uint)st.st_size;
+  return (const char *)data;
+#endif
+}
+
+/** Releases a mapping of \a size bytes at \a data returned by portable_mapFile(). */
+void portable_unmapFile(const char *data,uint size)
+{
+  if (data==0) return;
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  (void)size;
+  UnmapViewOfFile(data);
+#else
+  munmap((void *)data,size);
+#endif
+}
+
+/** Lists directory \a dirName and retrieves the attributes of its entries,
+ *  without using any shared state, so it can be called from any thread.
+ *  The paths of the sub directories whose name does not start with a '.'
+ *  are appended to \a subDirs. Symbolic links to directories are only
+ *  followed if \a followSymLinks is TRUE, and are reported by their target.
+ *  Returns FALSE if the directory could not be read.
+ */
+bool portable_readDirAttributes(const char *dirName,bool followSymLinks,QStrList &subDirs)
+{
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  (void)followSymLinks;
+  WIN32_FIND_DATAA data;
+  HANDLE h = FindFirstFileA(QCString(dirName)+"\\*",&data);
+  if (h==INVALID_HANDLE_VALUE) return FALSE;
+  do
+  {
+    if ((data.dwFileAttributes&FILE_ATTRIBUTE_DIRECTORY) &&
+        !(data.dwFileAttributes&FILE_ATTRIBUTE_REPARSE_POINT) &&
+        data.cFileName[0]!='.')
+    {
+      subDirs.append(QCString(dirName)+"/"+data.cFileName);
+    }
+  }
+  while (FindNextFileA(h,&data));
+  FindClose(h);
+  return TRUE;
+#else
+  DIR *dir = opendir(dirName);
+  if (dir==0) return FALSE;
+  struct dirent *de;
+  while ((de=readdir(dir)))
+  {
+    QCString path = QCString(dirName)+"/"+de->d_name;
+    struct stat st;
+    if (lstat(path,&st)!=0) continue;
+    bool isSymLink = S_ISLNK(st.st_mode);
+    if (isSymLink && (!followSymLinks || stat(path,&st)!=0)) continue;
+    if (access(path,R_OK)!=0) continue;
+    if (S_ISDIR(st.st_mode) && de->d_name[0]!='.')
+    {
+      if (isSymLink)
+      {
+        char *target = realpath(path,0);
+        if (target)
+        {
+          subDirs.append(target);
+          free(target);
+        }
+      }
+      else
+      {
+        subDirs.append(path);
+      }
+    }
+  }
+  closedir(dir);
+  return TRUE;
+#endif
+}
+
+/** Returns the peak resident memory size of the process in bytes,
+ *  or 0 if it is not known on this platform.
+ */
+uint64 portable_peakMemoryUsage()
+{
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF,&usage)!=0) return 0;
+#if defined(__APPLE__)
+  return (uint64)usage.ru_maxrss; // already in bytes
+#else
+  return (uint64)usage.ru_maxrss*1024;
+#endif
+#endif
+}
@@ -5,6 +5,8 @@
 #include <stdio.h>
 #include <qglobal.h>
 
+class QStrList;
+
 #if defined(_WIN32)
 typedef __int64 portable_off_t;
 #else
@@ -37,6 +39,10 @@ double         portable_getSysElapsedTime();
 void           portable_sleep(int ms);
 bool           portable_isAbsolutePath(const char *fileName);
 void           portable_correct_path(void);
+const char *   portable_mapFile(const char *fileName,uint &size);
+void           portable_unmapFile(const char *data,uint size);
+bool           portable_readDirAttributes(const char *dirName,bool followSymLinks,QStrList &subDirs);
+uint64         portable_peakMemoryUsage();
 
 extern "C" {
   void *         portable_iconv_open(const char* tocode, const char* fromcode);
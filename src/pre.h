@@ -18,12 +18,35 @@
 #ifndef PRE_H
 #define PRE_H
 
+#include <qglobal.h>
+#include "chunkedinput.h"
+
 class BufStr;
 
 void initPreprocessor();
 void cleanUpPreprocessor();
 void addSearchDir(const char *dir);
-void preprocessFile(const char *fileName,BufStr &input,BufStr &output);
-void preFreeScanner();
+/** Stores the defines made by included files in directory \a dirName,
+ *  so files that are included again with the same macros need not be read.
+ */
+void initHeaderCache(const char *dirName);
+void cleanUpHeaderCache();
+void preprocessFile(const char *fileName,const char *input,uint size,BufStr &output);
+
+/** @brief Preprocesses a file while its output is being read.
+ *
+ *  Gives the same text as preprocessFile(), with a newline added at the
+ *  end if needed, but only keeps the part that has not been read yet.
+ */
+class PreprocessorStream : public ChunkedInput
+{
+  public:
+    PreprocessorStream(const char *fileName,const char *input,uint size);
+   ~PreprocessorStream();
+    int read(char *buf,int maxSize);
+  private:
+    struct Private;
+    Private *p;
+};
 
 #endif
@@ -29,7 +29,8 @@
 class CLanguageScanner : public ParserInterface
 {
   public:
-    virtual ~CLanguageScanner() {}
+    CLanguageScanner();
+    virtual ~CLanguageScanner();
     void startTranslationUnit(const char *fileName);
     void finishTranslationUnit();
     void parseInput(const char *fileName,
@@ -37,6 +38,11 @@ class CLanguageScanner : public ParserInterface
                     Entry *root,
                     bool sameTranslationUnit,
                     QStrList &filesInSameTranslationUnit);
+    void parseInputStream(const char *fileName,
+                          ChunkedInput &input,
+                          Entry *root,
+                          bool sameTranslationUnit,
+                          QStrList &filesInSameTranslationUnit);
     bool needsPreprocessing(const QCString &extension);
     void parseCode(CodeOutputInterface &codeOutIntf,
                    const char *scopeName,
@@ -55,8 +61,9 @@ class CLanguageScanner : public ParserInterface
                   );
     void resetCodeParserState();
     void parsePrototype(const char *text);
+  private:
+    struct Private;
+    Private *p;
 };
 
-void scanFreeScanner();
-
 #endif
@@ -0,0 +1,219 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "symbolmap.h"
+#include "definition.h"
+
+static const int poolBlockSize = 65536;
+
+/** Block of memory holding the names of the atoms */
+struct SymbolNameBlock
+{
+  SymbolNameBlock *next;
+  int used;
+  int size;
+  char data[1];
+};
+
+struct SymbolMap::Private
+{
+  Private() : numAtoms(0), maxAtoms(0), names(0), hashes(0), values(0),
+              slots(0), numSlots(0), blocks(0) {}
+  int numAtoms;
+  int maxAtoms;
+  const char **names;      //!< name of each atom
+  uint *hashes;            //!< hash value of the name of each atom
+  DefinitionIntf **values; //!< definitions of each atom
+  int *slots;              //!< open addressing table of atoms, -1 for an empty slot
+  int numSlots;            //!< always a power of 2
+  SymbolNameBlock *blocks;
+
+  static uint hash(const char *s)
+  {
+    uint h=2166136261u;
+    while (*s) h=(h^(uchar)*s++)*16777619u;
+    return h;
+  }
+  //! returns the slot of \a name, or the empty slot where it should go
+  int findSlot(const char *name,uint h) const
+  {
+    int mask=numSlots-1;
+    int i=(int)(h&mask);
+    int a;
+    while ((a=slots[i])!=-1)
+    {
+      if (hashes[a]==h && qstrcmp(names[a],name)==0) break;
+      i=(i+1)&mask;
+    }
+    return i;
+  }
+  const char *storeName(const char *name)
+  {
+    int len = qstrlen(name)+1;
+    if (blocks==0 || blocks->used+len>blocks->size)
+    {
+      int size = QMAX(len,poolBlockSize);
+      SymbolNameBlock *b = (SymbolNameBlock*)malloc(sizeof(SymbolNameBlock)+size);
+      b->next = blocks;
+      b->used = 0;
+      b->size = size;
+      blocks = b;
+    }
+    char *s = blocks->data+blocks->used;
+    memcpy(s,name,len);
+    blocks->used+=len;
+    return s;
+  }
+  void growSlots()
+  {
+    free(slots);
+    numSlots = numSlots==0 ? 65536 : numSlots*2;
+    slots = (int*)malloc(numSlots*sizeof(int));
+    memset(slots,0xff,numSlots*sizeof(int));
+    int mask=numSlots-1;
+    int a;
+    for (a=0;a<numAtoms;a++)
+    {
+      int i=(int)(hashes[a]&mask);
+      while (slots[i]!=-1) i=(i+1)&mask;
+      slots[i]=a;
+    }
+  }
+  void growAtoms()
+  {
+    maxAtoms = maxAtoms==0 ? 16384 : maxAtoms*2;
+    names  = (const char **)realloc(names,maxAtoms*sizeof(const char *));
+    hashes = (uint *)realloc(hashes,maxAtoms*sizeof(uint));
+    values = (DefinitionIntf **)realloc(values,maxAtoms*sizeof(DefinitionIntf *));
+  }
+};
+
+SymbolMap::SymbolMap() : p(new Private)
+{
+  p->growSlots();
+}
+
+SymbolMap::~SymbolMap()
+{
+  int a;
+  for (a=0;a<p->numAtoms;a++)
+  {
+    DefinitionIntf *di = p->values[a];
+    if (di && di->definitionType()==DefinitionIntf::TypeSymbolList)
+    {
+      delete (DefinitionList*)di;
+    }
+  }
+  SymbolNameBlock *b = p->blocks;
+  while (b)
+  {
+    SymbolNameBlock *next = b->next;
+    free(b);
+    b = next;
+  }
+  free(p->names);
+  free(p->hashes);
+  free(p->values);
+  free(p->slots);
+  delete p;
+}
+
+int SymbolMap::atom(const char *name)
+{
+  if (name==0) name="";
+  uint h = Private::hash(name);
+  int i = p->findSlot(name,h);
+  if (p->slots[i]!=-1) return p->slots[i];
+  // new name
+  if (p->numAtoms==p->maxAtoms) p->growAtoms();
+  int a = p->numAtoms++;
+  p->names[a]  = p->storeName(name);
+  p->hashes[a] = h;
+  p->values[a] = 0;
+  p->slots[i]  = a;
+  if (p->numAtoms*2>p->numSlots) p->growSlots(); // keep the load factor below 0.5
+  return a;
+}
+
+int SymbolMap::findAtom(const char *name) const
+{
+  if (name==0) name="";
+  return p->slots[p->findSlot(name,Private::hash(name))];
+}
+
+const char *SymbolMap::atomName(int atom) const
+{
+  return atom>=0 && atom<p->numAtoms ? p->names[atom] : 0;
+}
+
+DefinitionIntf *SymbolMap::find(const char *name) const
+{
+  int a = findAtom(name);
+  return a==-1 ? 0 : p->values[a];
+}
+
+DefinitionIntf *SymbolMap::find(int atom) const
+{
+  return atom>=0 && atom<p->numAtoms ? p->values[atom] : 0;
+}
+
+void SymbolMap::add(int atom,Definition *d)
+{
+  DefinitionIntf *di = p->values[atom];
+  if (di==0) // new symbol
+  {
+    p->values[atom] = d;
+  }
+  else if (di->definitionType()==DefinitionIntf::TypeSymbolList) // already multiple symbols
+  {
+    ((DefinitionList*)di)->append(d);
+  }
+  else // going from one to two symbols
+  {
+    DefinitionList *dl = new DefinitionList;
+    dl->append((Definition*)di);
+    dl->append(d);
+    p->values[atom] = dl;
+  }
+}
+
+void SymbolMap::remove(int atom,Definition *d)
+{
+  DefinitionIntf *di = find(atom);
+  if (di==0) return;
+  if (di!=d) // symbol name not unique
+  {
+    DefinitionList *dl = (DefinitionList*)di;
+    bool b = dl->removeRef(d);
+    ASSERT(b==TRUE);
+    if (dl->isEmpty())
+    {
+      p->values[atom] = 0;
+      delete dl;
+    }
+  }
+  else // symbol name unique
+  {
+    p->values[atom] = 0;
+  }
+}
+
+int SymbolMap::numAtoms() const
+{
+  return p->numAtoms;
+}
@@ -0,0 +1,91 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2019 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#ifndef SYMBOLMAP_H
+#define SYMBOLMAP_H
+
+#include <qcstring.h>
+
+class Definition;
+class DefinitionIntf;
+
+/** @brief Map from the local name of a symbol to its definitions.
+ *
+ *  Each name is interned once and gets a stable integer id, its \e atom.
+ *  Atoms are numbered from 0 and are never reused, so the definitions
+ *  are stored in a flat array indexed by atom and two names are equal
+ *  if and only if their atoms are equal.
+ *
+ *  For each atom the map stores either a single Definition or, if
+ *  multiple definitions have the same name, a DefinitionList.
+ */
+class SymbolMap
+{
+  public:
+    SymbolMap();
+   ~SymbolMap();
+
+    /** Returns the atom of \a name, adding the name if it is new. */
+    int atom(const char *name);
+
+    /** Returns the atom of \a name, or -1 if the name was never added. */
+    int findAtom(const char *name) const;
+
+    /** Returns the name of the atom \a atom. */
+    const char *atomName(int atom) const;
+
+    /** Returns the definitions of \a name, or 0 if there are none. */
+    DefinitionIntf *find(const char *name) const;
+
+    /** Returns the definitions of the atom \a atom, or 0 if there are none. */
+    DefinitionIntf *find(int atom) const;
+
+    /** Adds definition \a d to the definitions of the atom \a atom. */
+    void add(int atom,Definition *d);
+
+    /** Removes definition \a d from the definitions of the atom \a atom. */
+    void remove(int atom,Definition *d);
+
+    /** Returns the number of atoms. */
+    int numAtoms() const;
+
+    /** Iterator over the atoms that have definitions */
+    class Iterator
+    {
+      public:
+        Iterator(const SymbolMap &map) : m_map(map), m_atom(-1) { toFirst(); }
+        void toFirst() { m_atom=-1; next(); }
+        DefinitionIntf *current() const { return m_atom<m_map.numAtoms() ? m_map.find(m_atom) : 0; }
+        const char *currentKey() const { return m_map.atomName(m_atom); }
+        int currentAtom() const { return m_atom; }
+        DefinitionIntf *operator++() { next(); return current(); }
+      private:
+        void next()
+        {
+          int n=m_map.numAtoms();
+          do { m_atom++; } while (m_atom<n && m_map.find(m_atom)==0);
+        }
+        const SymbolMap &m_map;
+        int m_atom;
+    };
+
+  private:
+    SymbolMap(const SymbolMap &);
+    SymbolMap &operator=(const SymbolMap &);
+    struct Private;
+    Private *p;
+};
+
+#endif
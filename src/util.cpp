@@ -20,6 +20,9 @@
 #include <math.h>
 #include <limits.h>
 
+#include <vector>
+#include <algorithm>
+
 #include "md5.h"
 
 #include <qregexp.h>
@@ -27,6 +30,7 @@
 #include <qdir.h>
 #include <qdatetime.h>
 #include <qcache.h>
+#include <qmutex.h>
 
 #include "util.h"
 #include "message.h"
@@ -49,6 +53,9 @@
 #include "textdocvisitor.h"
 #include "latexdocvisitor.h"
 #include "portable.h"
+#include "patternmatcher.h"
+#include "lookupcache.h"
+#include "symbolmap.h"
 #include "parserintf.h"
 #include "bufstr.h"
 #include "image.h"
@@ -276,10 +283,12 @@ QCString generateMarker(int id)
 static QCString stripFromPath(const QCString &path,QStrList &l)
 {
   // look at all the strings in the list and strip the longest match  
-  const char *s=l.first();
+  // (using an iterator, so the list itself is not changed)
+  QStrListIterator sli(l);
+  const char *s;
   QCString potential;
   unsigned int length = 0;
-  while (s)
+  for (sli.toFirst();(s=sli.current());++sli)
   {
     QCString prefix = s;
     if (prefix.length() > length &&
@@ -288,7 +297,6 @@ static QCString stripFromPath(const QCString &path,QStrList &l)
       length = prefix.length();
       potential = path.right(path.length()-prefix.length());
     }
-    s = l.next();
   }
   if (length) return potential;
   return path;
@@ -517,6 +525,10 @@ NamespaceDef *getResolvedNamespace(const char *name)
 static QDict<MemberDef> g_resolvedTypedefs;
 static QDict<Definition> g_visitedNamespaces;
 
+// number of times a walk in isAccessibleFrom() or isAccessibleFromWithExpScope()
+// stopped at a scope that was already being visited
+static uint g_accessCutOffs;
+
 // forward declaration
 static const ClassDef *getResolvedClassRec(const Definition *scope,
                               const FileDef *fileScope,
@@ -854,20 +866,25 @@ bool accessibleViaUsingNamespace(const NamespaceSDict *nl,
         //printf("] found it\n");
         return TRUE; 
       }
-      if (item->getLanguage()==SrcLangExt_Cpp)
+      if (item->getLanguage()==SrcLangExt_Cpp && und->getUsedNamespaces())
       {
         QCString key=und->name();
-        if (und->getUsedNamespaces() && visitedDict.find(key)==0)
+        if (visitedDict.find(key)==0)
         {
           visitedDict.insert(key,(void *)0x08);
 
-          if (accessibleViaUsingNamespace(und->getUsedNamespaces(),fileScope,item,explicitScopePart))
+          bool found = accessibleViaUsingNamespace(und->getUsedNamespaces(),fileScope,item,explicitScopePart);
+
+          visitedDict.remove(key);
+          if (found)
           {
             //printf("] found it via recursion\n");
             return TRUE;
           }
-
-          visitedDict.remove(key);
+        }
+        else
+        {
+          g_accessCutOffs++;
         }
       }
       //printf("] Try via used namespace done\n");
@@ -910,6 +927,10 @@ class AccessStack
     {
       if (m_index>0) m_index--;
     }
+    bool isEmpty() const
+    {
+      return m_index==0;
+    }
     bool find(const Definition *scope,const FileDef *fileScope, const Definition *item)
     {
       int i=0;
@@ -950,6 +971,96 @@ class AccessStack
     AccessElem m_elements[MAX_STACK_SIZE];
 };
 
+const int ACCESS_CACHE_SIZE = 32768; // must be a power of 2
+
+/** Helper class storing the results of isAccessibleFrom() and
+ *  isAccessibleFromWithExpScope().
+ *
+ *  The result of a call depends on the scopes already being visited by the
+ *  calls higher up the stack. So a result is only stored if the walk did not
+ *  stop at such a scope, and only used for calls that are not nested.
+ *  All results are dropped when the relations between scopes change,
+ *  see invalidateAccessCache().
+ */
+class AccessCache
+{
+  public:
+    AccessCache() : m_generation(1), m_hits(0), m_misses(0) {}
+    bool find(const Definition *scope,const FileDef *fileScope,const Definition *item,
+              const QCString &expScope,int &result)
+    {
+      AccessElem *e = &m_elements[index(scope,fileScope,item,expScope)];
+      if (e->generation==m_generation && e->scope==scope && e->fileScope==fileScope &&
+          e->item==item && e->expScope==expScope)
+      {
+        m_hits++;
+        result = e->result;
+        return TRUE;
+      }
+      m_misses++;
+      return FALSE;
+    }
+    void insert(const Definition *scope,const FileDef *fileScope,const Definition *item,
+                const QCString &expScope,int result)
+    {
+      AccessElem *e = &m_elements[index(scope,fileScope,item,expScope)];
+      e->scope      = scope;
+      e->fileScope  = fileScope;
+      e->item       = item;
+      e->expScope   = expScope;
+      e->result     = result;
+      e->generation = m_generation;
+    }
+    void invalidate() { m_generation++; }
+    uint hits() const { return m_hits; }
+    uint misses() const { return m_misses; }
+
+  private:
+    static uint index(const Definition *scope,const FileDef *fileScope,const Definition *item,
+                      const QCString &expScope)
+    {
+      uint h = (uint)((size_t)scope>>3);
+      h = h*31 + (uint)((size_t)fileScope>>3);
+      h = h*31 + (uint)((size_t)item>>3);
+      const char *p = expScope.data();
+      if (p) while (*p) h = h*31 + (uchar)*p++;
+      return (h^(h>>15))&(ACCESS_CACHE_SIZE-1);
+    }
+    /** Element in the cache. */
+    struct AccessElem
+    {
+      AccessElem() : scope(0), fileScope(0), item(0), result(0), generation(0) {}
+      const Definition *scope;
+      const FileDef *fileScope;
+      const Definition *item;
+      QCString expScope;
+      int result;
+      uint generation;
+    };
+    uint m_generation;
+    uint m_hits;
+    uint m_misses;
+    AccessElem m_elements[ACCESS_CACHE_SIZE];
+};
+
+static AccessCache g_accessCache;
+
+static void invalidateInheritanceClosure();
+
+void invalidateAccessCache()
+{
+  g_accessCache.invalidate();
+  invalidateInheritanceClosure();
+  // canonical types depend on which symbols are accessible from a scope
+  invalidateCanonicalTypeCache();
+}
+
+void getAccessCacheStats(uint &avoided,uint &computed)
+{
+  avoided  = g_accessCache.hits();
+  computed = g_accessCache.misses();
+}
+
 /* Returns the "distance" (=number of levels up) from item to scope, or -1
  * if item in not inside scope. 
  */
@@ -959,13 +1070,20 @@ int isAccessibleFrom(const Definition *scope,const FileDef *fileScope,const Defi
   //    scope->name().data(),item->name().data(),item->getOuterScope()->name().data());
 
   static AccessStack accessStack;
+  static QCString noExpScope;
+  int result=0; // assume we found it
+  if (accessStack.isEmpty() && g_accessCache.find(scope,fileScope,item,noExpScope,result))
+  {
+    return result;
+  }
   if (accessStack.find(scope,fileScope,item))
   {
+    g_accessCutOffs++;
     return -1;
   }
   accessStack.push(scope,fileScope,item);
+  uint cutOffs = g_accessCutOffs;
 
-  int result=0; // assume we found it
   int i;
 
   Definition *itemScope=item->getOuterScope();
@@ -1036,7 +1154,10 @@ int isAccessibleFrom(const Definition *scope,const FileDef *fileScope,const Defi
   }
 done:
   accessStack.pop();
-  //Doxygen::lookupCache.insert(key,new int(result));
+  if (cutOffs==g_accessCutOffs)
+  {
+    g_accessCache.insert(scope,fileScope,item,noExpScope,result);
+  }
   return result;
 }
 
@@ -1066,17 +1187,24 @@ int isAccessibleFromWithExpScope(const Definition *scope,const FileDef *fileScop
   }
 
   static AccessStack accessStack;
+  int result=0; // assume we found it
+  if (accessStack.isEmpty() && g_visitedNamespaces.isEmpty() &&
+      g_accessCache.find(scope,fileScope,item,explicitScopePart,result))
+  {
+    return result;
+  }
   if (accessStack.find(scope,fileScope,item,explicitScopePart))
   {
+    g_accessCutOffs++;
     return -1;
   }
   accessStack.push(scope,fileScope,item,explicitScopePart);
+  uint cutOffs = g_accessCutOffs;
 
 
   //printf("  <isAccessibleFromWithExpScope(%s,%s,%s)\n",scope?scope->name().data():"<global>",
   //                                      item?item->name().data():"<none>",
   //                                      explicitScopePart.data());
-  int result=0; // assume we found it
   const Definition *newScope = followPath(scope,fileScope,explicitScopePart);
   if (newScope)  // explicitScope is inside scope => newScope is the result
   {
@@ -1152,6 +1280,10 @@ int isAccessibleFromWithExpScope(const Definition *scope,const FileDef *fileScop
                 goto done;
               }
             }
+            else
+            {
+              g_accessCutOffs++;
+            }
           }
         }
       }
@@ -1204,7 +1336,10 @@ int isAccessibleFromWithExpScope(const Definition *scope,const FileDef *fileScop
 done:
   //printf("  > result=%d\n",result);
   accessStack.pop();
-  //Doxygen::lookupCache.insert(key,new int(result));
+  if (cutOffs==g_accessCutOffs)
+  {
+    g_accessCache.insert(scope,fileScope,item,explicitScopePart,result);
+  }
   return result;
 }
 
@@ -1479,26 +1614,26 @@ static const ClassDef *getResolvedClassRec(const Definition *scope,
   }
   *p='\0';
 
-  LookupInfo *pval=Doxygen::lookupCache->find(key);
-  //printf("Searching for %s result=%p\n",key.data(),pval);
-  if (pval)
+  LookupInfo info;
+  //printf("Searching for %s\n",key.data());
+  if (Doxygen::lookupCache->find(key,info))
   {
     //printf("LookupInfo %p %p '%s' %p\n", 
-    //    pval->classDef, pval->typeDef, pval->templSpec.data(), 
-    //    pval->resolvedType.data()); 
-    if (pTemplSpec)    *pTemplSpec=pval->templSpec;
-    if (pTypeDef)      *pTypeDef=pval->typeDef;
-    if (pResolvedType) *pResolvedType=pval->resolvedType;
+    //    info.classDef, info.typeDef, info.templSpec.data(), 
+    //    info.resolvedType.data()); 
+    if (pTemplSpec)    *pTemplSpec=info.templSpec;
+    if (pTypeDef)      *pTypeDef=info.typeDef;
+    if (pResolvedType) *pResolvedType=info.resolvedType;
     //printf("] cachedMatch=%s\n",
-    //    pval->classDef?pval->classDef->name().data():"<none>");
+    //    info.classDef?info.classDef->name().data():"<none>");
     //if (pTemplSpec) 
     //  printf("templSpec=%s\n",pTemplSpec->data());
-    return pval->classDef; 
+    return info.classDef; 
   }
   else // not found yet; we already add a 0 to avoid the possibility of 
     // endless recursion.
   {
-    Doxygen::lookupCache->insert(key,new LookupInfo);
+    Doxygen::lookupCache->insertPending(key);
   }
 
   const ClassDef *bestMatch=0;
@@ -1544,18 +1679,7 @@ static const ClassDef *getResolvedClassRec(const Definition *scope,
   //printf("getResolvedClassRec: bestMatch=%p pval->resolvedType=%s\n",
   //    bestMatch,bestResolvedType.data());
 
-  pval=Doxygen::lookupCache->find(key);
-  if (pval)
-  {
-    pval->classDef     = bestMatch;
-    pval->typeDef      = bestTypedef;
-    pval->templSpec    = bestTemplSpec;
-    pval->resolvedType = bestResolvedType;
-  }
-  else
-  {
-    Doxygen::lookupCache->insert(key,new LookupInfo(bestMatch,bestTypedef,bestTemplSpec,bestResolvedType));
-  }
+  Doxygen::lookupCache->insert(key,LookupInfo(bestMatch,bestTypedef,bestTemplSpec,bestResolvedType));
   //printf("] bestMatch=%s distance=%d\n",
   //    bestMatch?bestMatch->name().data():"<none>",minDistance);
   //if (pTemplSpec) 
@@ -1701,7 +1825,7 @@ struct CharAroundSpace
 
 static CharAroundSpace g_charAroundSpace;
 
-// Note: this function is not reentrant due to the use of static buffer!
+// Note: this function is not reentrant due to the use of a static buffer per thread!
 QCString removeRedundantWhiteSpace(const QCString &s)
 {
   static bool cliSupport = Config_getBool(CPP_CLI_SUPPORT);
@@ -1709,10 +1833,12 @@ QCString removeRedundantWhiteSpace(const QCString &s)
 
   if (s.isEmpty() || vhdl) return s;
 
-  // We use a static character array to
+  // We use a static character array (one per thread) to
   // improve the performance of this function
-  static char *growBuf = 0;
-  static int growBufLen = 0;
+  struct Buffer { char *data = 0; int len = 0; ~Buffer() { free(data); } };
+  static thread_local Buffer buffer;
+  char *&growBuf = buffer.data;
+  int &growBufLen = buffer.len;
   if ((int)s.length()*3>growBufLen) // For input character we produce at most 3 output characters,
   {
     growBufLen = s.length()*3;
@@ -1936,6 +2062,11 @@ QCString removeRedundantWhiteSpace(const QCString &s)
     }
     pc=c;
   }
+  // most strings are already normalized, return them without a new copy
+  if ((uint)(dst-growBuf)==s.length() && memcmp(growBuf,s.data(),s.length())==0)
+  {
+    return s;
+  }
   *dst++='\0';
   //printf("removeRedundantWhitespace(%s)->%s\n",s.data(),growBuf);
   return growBuf;
@@ -2013,6 +2144,125 @@ bool leftScopeMatch(const QCString &scope, const QCString &name)
 }
 
 
+/** Helper class holding the local names of all symbols.
+ *
+ *  A word can only be linked by linkifyText() if the part after the last
+ *  scope separator is the name of a class, a member or another symbol.
+ *  To keep the set compact only a 64 bit hash of each name is stored, in
+ *  an open addressing table. A hash collision merely causes a word to be
+ *  looked up, so it can never hide a link.
+ */
+class LinkifyFilter
+{
+  public:
+    LinkifyFilter() : m_hashes(0), m_mask(0), m_skipped(0), m_lookedUp(0) {}
+   ~LinkifyFilter() { delete[] m_hashes; }
+    void build()
+    {
+      uint count = Doxygen::symbolMap->numAtoms()+
+                   Doxygen::classSDict->count()+Doxygen::hiddenClasses->count()+
+                   Doxygen::memberNameSDict->count()+Doxygen::functionNameSDict->count();
+      uint size = 1024;
+      while (size<2*count) size*=2;
+      delete[] m_hashes;
+      m_hashes = new uint64[size];
+      memset(m_hashes,0,size*sizeof(uint64));
+      m_mask = size-1;
+
+      SymbolMap::Iterator sli(*Doxygen::symbolMap);
+      for (;sli.current();++sli) addName(sli.currentKey());
+      addClassNames(Doxygen::classSDict);
+      addClassNames(Doxygen::hiddenClasses);
+      addMemberNames(Doxygen::memberNameSDict);
+      addMemberNames(Doxygen::functionNameSDict);
+    }
+    bool isEnabled() const { return m_hashes!=0; }
+    /** Returns FALSE if \a word cannot refer to a known symbol */
+    bool mayMatch(const QCString &word)
+    {
+      int i = word.findRev("::");
+      const char *name = i==-1 ? word.data() : word.data()+i+2;
+      if (*name=='\0' || contains(hash(name,qstrlen(name))))
+      {
+        m_lookedUp++;
+        return TRUE;
+      }
+      m_skipped++;
+      return FALSE;
+    }
+    uint skipped() const { return m_skipped; }
+    uint lookedUp() const { return m_lookedUp; }
+
+  private:
+    static uint64 hash(const char *s,int len)
+    {
+      uint64 h=14695981039346656037ULL;
+      while (len-->0) h=(h^(uchar)*s++)*1099511628211ULL;
+      return h==0 ? 1 : h; // 0 marks an empty slot
+    }
+    bool contains(uint64 h) const
+    {
+      uint i = (uint)h&m_mask;
+      while (m_hashes[i]!=0)
+      {
+        if (m_hashes[i]==h) return TRUE;
+        i=(i+1)&m_mask;
+      }
+      return FALSE;
+    }
+    void add(uint64 h)
+    {
+      uint i = (uint)h&m_mask;
+      while (m_hashes[i]!=0)
+      {
+        if (m_hashes[i]==h) return;
+        i=(i+1)&m_mask;
+      }
+      m_hashes[i]=h;
+    }
+    void addName(const char *n)
+    {
+      if (n==0) return;
+      QCString name = n;
+      int i = name.findRev("::");
+      const char *p = i==-1 ? name.data() : name.data()+i+2;
+      int len = qstrlen(p);
+      add(hash(p,len));
+      // Obj-C protocols and C# generics are also found without their suffix
+      if (len>2 && p[len-2]=='-' && (p[len-1]=='p' || p[len-1]=='g'))
+      {
+        add(hash(p,len-2));
+      }
+    }
+    void addClassNames(const ClassSDict *cl)
+    {
+      ClassSDict::IteratorDict cli(*cl);
+      for (;cli.current();++cli) addName(cli.currentKey());
+    }
+    void addMemberNames(const MemberNameSDict *mnd)
+    {
+      MemberNameSDict::IteratorDict mni(*mnd);
+      for (;mni.current();++mni) addName(mni.currentKey());
+    }
+    uint64 *m_hashes;
+    uint m_mask;
+    uint m_skipped;
+    uint m_lookedUp;
+};
+
+static LinkifyFilter g_linkifyFilter;
+
+void initLinkifyFilter()
+{
+  g_linkifyFilter.build();
+}
+
+void getLinkifyFilterStats(uint &skipped,uint &lookedUp)
+{
+  skipped  = g_linkifyFilter.skipped();
+  lookedUp = g_linkifyFilter.lookedUp();
+}
+
 void linkifyText(const TextGeneratorIntf &out, const Definition *scope,
     const FileDef *fileScope,const Definition *self,
     const char *text, bool autoBreak,bool external,
@@ -2086,7 +2336,7 @@ void linkifyText(const TextGeneratorIntf &out, const Definition *scope,
     //printf("linkifyText word=%s matchWord=%s scope=%s\n",
     //    word.data(),matchWord.data(),scope?scope->name().data():"<none>");
     bool found=FALSE;
-    if (!insideString)
+    if (!insideString && (!g_linkifyFilter.isEnabled() || g_linkifyFilter.mayMatch(matchWord)))
     {
       const MemberDef    *md=0;
       const ClassDef     *cd=0;
@@ -2419,32 +2669,21 @@ int filterCRLF(char *buf,int len)
   return dest;                 // length of the valid part of the buf
 }
 
-static QCString getFilterFromList(const char *name,const QStrList &filterList,bool &found)
+static QCString getFilterFromList(const char *name,const PatternMatcher &filterList,bool &found)
 {
   found=FALSE;
   // compare the file name to the filter pattern list
-  QStrListIterator sli(filterList);
-  char* filterStr;
-  for (sli.toFirst(); (filterStr = sli.current()); ++sli)
-  {
-    QCString fs = filterStr;
-    int i_equals=fs.find('=');
-    if (i_equals!=-1)
-    {
-      QCString filterPattern = fs.left(i_equals);
-      QRegExp fpat(filterPattern,portable_fileSystemIsCaseSensitive(),TRUE); 
-      if (fpat.match(name)!=-1) 
-      {
-        // found a match!
-        QCString filterName = fs.mid(i_equals+1);
-        if (filterName.find(' ')!=-1)
-        { // add quotes if the name has spaces
-          filterName="\""+filterName+"\"";
-        }
-        found=TRUE;
-        return filterName;
-      }
+  int i = filterList.findFirst(name);
+  if (i!=-1)
+  {
+    // found a match!
+    QCString filterName = filterList.value(i);
+    if (filterName.find(' ')!=-1)
+    { // add quotes if the name has spaces
+      filterName="\""+filterName+"\"";
     }
+    found=TRUE;
+    return filterName;
   }
 
   // no match
@@ -2461,8 +2700,11 @@ QCString getFileFilter(const char* name,bool isSourceCode)
   // sanity check
   if (name==0) return "";
 
-  QStrList& filterSrcList = Config_getList(FILTER_SOURCE_PATTERNS);
-  QStrList& filterList    = Config_getList(FILTER_PATTERNS);
+  // only the patterns with a filter name are relevant
+  static PatternMatcher filterSrcList(&Config_getList(FILTER_SOURCE_PATTERNS),
+                                      portable_fileSystemIsCaseSensitive(),TRUE);
+  static PatternMatcher filterList(&Config_getList(FILTER_PATTERNS),
+                                   portable_fileSystemIsCaseSensitive(),TRUE);
 
   QCString filterName;
   bool found=FALSE;
@@ -2644,7 +2886,7 @@ QCString yearToString()
 // recursive function that returns the number of branches in the 
 // inheritance tree that the base class 'bcd' is below the class 'cd'
 
-int minClassDistance(const ClassDef *cd,const ClassDef *bcd,int level)
+static int minClassDistanceRec(const ClassDef *cd,const ClassDef *bcd,int level)
 {
   if (bcd->categoryOf()) // use class that is being extended in case of 
     // an Objective-C category
@@ -2665,7 +2907,7 @@ int minClassDistance(const ClassDef *cd,const ClassDef *bcd,int level)
     BaseClassDef *bcdi;
     for (;(bcdi=bcli.current());++bcli)
     {
-      int mc=minClassDistance(bcdi->classDef,bcd,level+1);
+      int mc=minClassDistanceRec(bcdi->classDef,bcd,level+1);
       if (mc<m) m=mc;
       if (m<0) break;
     }
@@ -2673,7 +2915,7 @@ int minClassDistance(const ClassDef *cd,const ClassDef *bcd,int level)
   return m;
 }
 
-Protection classInheritedProtectionLevel(const ClassDef *cd,const ClassDef *bcd,Protection prot,int level)
+static Protection classInheritedProtectionLevelRec(const ClassDef *cd,const ClassDef *bcd,Protection prot,int level)
 {
   if (bcd->categoryOf()) // use class that is being extended in case of 
     // an Objective-C category
@@ -2695,7 +2937,7 @@ Protection classInheritedProtectionLevel(const ClassDef *cd,const ClassDef *bcd,
     const BaseClassDef *bcdi;
     for (;(bcdi=bcli.current()) && prot!=Private;++bcli)
     {
-      Protection baseProt = classInheritedProtectionLevel(bcdi->classDef,bcd,bcdi->prot,level+1);
+      Protection baseProt = classInheritedProtectionLevelRec(bcdi->classDef,bcd,bcdi->prot,level+1);
       if (baseProt==Private)   prot=Private;
       else if (baseProt==Protected) prot=Protected;
     }
@@ -2705,6 +2947,207 @@ exit:
   return prot;
 }
 
+/** Helper class holding the ancestors of each class.
+ *
+ *  For a class the list of all its direct and indirect base classes is
+ *  computed once, together with the distance to each base class and the
+ *  restriction that classInheritedProtectionLevel() applies for it, so
+ *  both functions become a lookup in a sorted list instead of a walk over
+ *  the inheritance tree. The lists are computed on first use, each from
+ *  the lists of the direct base classes, and are dropped when the
+ *  inheritance relations change, see invalidateAccessCache().
+ *
+ *  Classes with a recursive or very deep inheritance relation keep using
+ *  the recursive functions, so they report the problem as before.
+ */
+class InheritanceClosure
+{
+  public:
+    InheritanceClosure() : m_classes(1009), m_generation(1)
+    {
+      m_classes.setAutoDelete(TRUE);
+    }
+    void invalidate() { m_generation++; }
+    int distance(const ClassDef *cd,const ClassDef *bcd)
+    {
+      const ClassNode *n = node(cd,0);
+      if (n==0) return minClassDistanceRec(cd,bcd,0);
+      const Ancestor *a = n->find(bcd);
+      return a ? a->distance : maxInheritanceDepth;
+    }
+    Protection protection(const ClassDef *cd,const ClassDef *bcd,Protection prot)
+    {
+      const ClassNode *n = node(cd,0);
+      if (n==0) return classInheritedProtectionLevelRec(cd,bcd,prot,0);
+      const Ancestor *a = n->find(bcd);
+      return restrict(prot,a ? a->restriction : n->treeRestriction);
+    }
+
+  private:
+    // most restrictive protection found on the inheritance paths
+    enum Restriction { NoRestriction=0, ProtectedRestriction=1, PrivateRestriction=2 };
+    static int restriction(Protection prot)
+    {
+      return prot==Private   ? PrivateRestriction :
+             prot==Protected ? ProtectedRestriction : NoRestriction;
+    }
+    static Protection restrict(Protection prot,int r)
+    {
+      if (prot==Private || r==PrivateRestriction) return Private;
+      if (r==ProtectedRestriction) return Protected;
+      return prot;
+    }
+    /** Base class of a class */
+    struct Ancestor
+    {
+      const ClassDef *classDef;
+      int distance;
+      int restriction;
+      bool operator<(const Ancestor &other) const { return classDef<other.classDef; }
+    };
+    /** Ancestors of a class, sorted on their address */
+    struct ClassNode
+    {
+      ClassNode() : generation(0), busy(FALSE), valid(FALSE), treeRestriction(NoRestriction) {}
+      const Ancestor *find(const ClassDef *bcd) const
+      {
+        Ancestor key;
+        key.classDef = bcd;
+        std::vector<Ancestor>::const_iterator it = std::lower_bound(ancestors.begin(),ancestors.end(),key);
+        return it!=ancestors.end() && it->classDef==bcd ? &*it : 0;
+      }
+      uint generation;
+      bool busy;
+      bool valid;
+      int treeRestriction; // restriction if the base class is not an ancestor
+      std::vector<Ancestor> ancestors;
+    };
+
+    // returns the node of class cd, or 0 if the recursive functions should be used
+    const ClassNode *node(const ClassDef *cd,int level)
+    {
+      ClassNode *n = m_classes.find((void*)cd);
+      if (n==0)
+      {
+        n = new ClassNode;
+        m_classes.insert((void*)cd,n);
+      }
+      if (n->generation==m_generation) return n->busy || !n->valid ? 0 : n;
+      if (level==256) return 0; // too deep, do not even try
+      n->generation = m_generation;
+      n->busy  = TRUE;
+      n->valid = build(n,cd,level);
+      n->busy  = FALSE;
+      return n->valid ? n : 0;
+    }
+    bool build(ClassNode *n,const ClassDef *cd,int level)
+    {
+      n->ancestors.clear();
+      n->treeRestriction = NoRestriction;
+      if (cd->baseClasses()==0) return TRUE;
+
+      // collect the nodes of the direct base classes
+      std::vector<const BaseClassDef *> bases;
+      std::vector<const ClassNode *> baseNodes;
+      BaseClassListIterator bcli(*cd->baseClasses());
+      const BaseClassDef *bcdi;
+      for (;(bcdi=bcli.current());++bcli)
+      {
+        const ClassNode *bn = node(bcdi->classDef,level+1);
+        if (bn==0) return FALSE; // recursive or too deep
+        bases.push_back(bcdi);
+        baseNodes.push_back(bn);
+        int r = QMAX(restriction(bcdi->prot),bn->treeRestriction);
+        n->treeRestriction = QMAX(n->treeRestriction,r);
+      }
+
+      // the ancestors are the direct base classes and their ancestors
+      std::vector<Ancestor> &anc = n->ancestors;
+      size_t i;
+      for (i=0;i<bases.size();i++)
+      {
+        Ancestor a;
+        a.classDef = bases[i]->classDef;
+        anc.push_back(a);
+        anc.insert(anc.end(),baseNodes[i]->ancestors.begin(),baseNodes[i]->ancestors.end());
+      }
+      std::sort(anc.begin(),anc.end());
+      size_t j,k=0;
+      for (j=0;j<anc.size();j++)
+      {
+        if (k==0 || anc[k-1].classDef!=anc[j].classDef) anc[k++]=anc[j];
+      }
+      anc.resize(k);
+
+      // for each ancestor combine the paths via all direct base classes
+      for (j=0;j<anc.size();j++)
+      {
+        Ancestor &a = anc[j];
+        int dist = maxInheritanceDepth;
+        int restr = NoRestriction;
+        for (i=0;i<bases.size();i++)
+        {
+          int r; // restriction of the path via base class i
+          if (bases[i]->classDef==a.classDef)
+          {
+            dist = 1;
+            r = NoRestriction;
+          }
+          else
+          {
+            const Ancestor *ba = baseNodes[i]->find(a.classDef);
+            if (ba)
+            {
+              dist = QMIN(dist,ba->distance+1);
+              r = ba->restriction;
+            }
+            else
+            {
+              r = baseNodes[i]->treeRestriction;
+            }
+          }
+          restr = QMAX(restr,QMAX(restriction(bases[i]->prot),r));
+        }
+        a.distance    = dist;
+        a.restriction = restr;
+      }
+      return TRUE;
+    }
+    QPtrDict<ClassNode> m_classes;
+    uint m_generation;
+};
+
+static InheritanceClosure g_inheritanceClosure;
+
+static void invalidateInheritanceClosure()
+{
+  g_inheritanceClosure.invalidate();
+}
+
+int minClassDistance(const ClassDef *cd,const ClassDef *bcd,int level)
+{
+  if (level!=0) return minClassDistanceRec(cd,bcd,level);
+  if (bcd->categoryOf()) // use class that is being extended in case of
+    // an Objective-C category
+  {
+    bcd=bcd->categoryOf();
+  }
+  if (cd==bcd) return 0;
+  return g_inheritanceClosure.distance(cd,bcd);
+}
+
+Protection classInheritedProtectionLevel(const ClassDef *cd,const ClassDef *bcd,Protection prot,int level)
+{
+  if (level!=0) return classInheritedProtectionLevelRec(cd,bcd,prot,level);
+  if (bcd->categoryOf()) // use class that is being extended in case of
+    // an Objective-C category
+  {
+    bcd=bcd->categoryOf();
+  }
+  if (cd==bcd) return prot;
+  return g_inheritanceClosure.protection(cd,bcd,prot);
+}
+
 //static void printArgList(ArgumentList *al)
 //{
 //  if (al==0) return;
@@ -3618,7 +4061,101 @@ static QCString getCanonicalTypeForIdentifier(
   return result;
 }
 
+const int CANONICAL_TYPE_CACHE_SIZE = 16384; // must be a power of 2
+
+/** Helper class storing the results of extractCanonicalType().
+ *
+ *  The same type strings are resolved over and over again when the
+ *  argument lists of overloaded members are compared, so the canonical
+ *  type is remembered per scope, file scope and type string.
+ *  All results are dropped when a type lookup could give a different
+ *  answer, see invalidateCanonicalTypeCache().
+ */
+class CanonicalTypeCache
+{
+  public:
+    CanonicalTypeCache() : m_generation(1), m_argHits(0), m_hits(0), m_misses(0) {}
+    bool find(const Definition *d,const FileDef *fs,const QCString &type,QCString &result)
+    {
+      CanonicalTypeElem *e = &m_elements[index(d,fs,type)];
+      if (e->generation==m_generation && e->scope==d && e->fileScope==fs && e->type==type)
+      {
+        m_hits++;
+        result = e->result;
+        return TRUE;
+      }
+      m_misses++;
+      return FALSE;
+    }
+    void insert(const Definition *d,const FileDef *fs,const QCString &type,const QCString &result)
+    {
+      CanonicalTypeElem *e = &m_elements[index(d,fs,type)];
+      e->scope      = d;
+      e->fileScope  = fs;
+      e->type       = type;
+      e->result     = result;
+      e->generation = m_generation;
+    }
+    void invalidate() { m_generation++; }
+    void argumentHit() { m_argHits++; }
+    uint argumentHits() const { return m_argHits; }
+    uint hits() const { return m_hits; }
+    uint misses() const { return m_misses; }
+
+  private:
+    static uint index(const Definition *d,const FileDef *fs,const QCString &type)
+    {
+      uint h = (uint)((size_t)d>>3);
+      h = h*31 + (uint)((size_t)fs>>3);
+      const char *p = type.data();
+      if (p) while (*p) h = h*31 + (uchar)*p++;
+      return (h^(h>>15))&(CANONICAL_TYPE_CACHE_SIZE-1);
+    }
+    /** Element in the cache. */
+    struct CanonicalTypeElem
+    {
+      CanonicalTypeElem() : scope(0), fileScope(0), generation(0) {}
+      const Definition *scope;
+      const FileDef *fileScope;
+      QCString type;
+      QCString result;
+      uint generation;
+    };
+    uint m_generation;
+    uint m_argHits;
+    uint m_hits;
+    uint m_misses;
+    CanonicalTypeElem m_elements[CANONICAL_TYPE_CACHE_SIZE];
+};
+
+static CanonicalTypeCache g_canonicalTypeCache;
+
+void invalidateCanonicalTypeCache()
+{
+  g_canonicalTypeCache.invalidate();
+}
+
+void getCanonicalTypeCacheStats(uint &argHits,uint &typeHits,uint &typeMisses)
+{
+  argHits    = g_canonicalTypeCache.argumentHits();
+  typeHits   = g_canonicalTypeCache.hits();
+  typeMisses = g_canonicalTypeCache.misses();
+}
+
+static QCString extractCanonicalTypeNoCache(const Definition *d,const FileDef *fs,QCString type);
+
 static QCString extractCanonicalType(const Definition *d,const FileDef *fs,QCString type)
+{
+  QCString result;
+  if (!g_canonicalTypeCache.find(d,fs,type,result))
+  {
+    result = extractCanonicalTypeNoCache(d,fs,type);
+    g_canonicalTypeCache.insert(d,fs,type,result);
+  }
+  return result;
+}
+
+static QCString extractCanonicalTypeNoCache(const Definition *d,const FileDef *fs,QCString type)
 {
   type = type.stripWhiteSpace();
 
@@ -3711,6 +4248,30 @@ static QCString extractCanonicalArgType(const Definition *d,const FileDef *fs,co
   return extractCanonicalType(d,fs,type);
 }
 
+/*! Returns 1 if matchArgument2() moves the name of \a srcA into its type,
+ *  2 if it does so for \a dstA, and 0 if it changes neither argument.
+ */
+static int argumentNameFixUp(const Argument *srcA,const Argument *dstA)
+{
+  QCString sSrcName = " "+srcA->name;
+  QCString sDstName = " "+dstA->name;
+  QCString srcType  = srcA->type;
+  QCString dstType  = dstA->type;
+  stripIrrelevantConstVolatile(srcType);
+  stripIrrelevantConstVolatile(dstType);
+  //printf("'%s'<->'%s'\n",sSrcName.data(),dstType.right(sSrcName.length()).data());
+  //printf("'%s'<->'%s'\n",sDstName.data(),srcType.right(sDstName.length()).data());
+  if (sSrcName==dstType.right(sSrcName.length()))
+  { // case "unsigned int" <-> "unsigned int i"
+    return 1;
+  }
+  else if (sDstName==srcType.right(sDstName.length()))
+  { // case "unsigned int i" <-> "unsigned int"
+    return 2;
+  }
+  return 0;
+}
+
 static bool matchArgument2(
     const Definition *srcScope,const FileDef *srcFileScope,Argument *srcA,
     const Definition *dstScope,const FileDef *dstFileScope,Argument *dstA
@@ -3727,23 +4288,16 @@ static bool matchArgument2(
   //  NOMATCH
   //  return FALSE;
   //}
-  QCString sSrcName = " "+srcA->name;
-  QCString sDstName = " "+dstA->name;
-  QCString srcType  = srcA->type;
-  QCString dstType  = dstA->type;
-  stripIrrelevantConstVolatile(srcType);
-  stripIrrelevantConstVolatile(dstType);
-  //printf("'%s'<->'%s'\n",sSrcName.data(),dstType.right(sSrcName.length()).data());
-  //printf("'%s'<->'%s'\n",sDstName.data(),srcType.right(sDstName.length()).data());
-  if (sSrcName==dstType.right(sSrcName.length()))
+  int fixUp = argumentNameFixUp(srcA,dstA);
+  if (fixUp==1)
   { // case "unsigned int" <-> "unsigned int i"
-    srcA->type+=sSrcName;
+    srcA->type+=" "+srcA->name;
     srcA->name="";
     srcA->canType=""; // invalidate cached type value
   }
-  else if (sDstName==srcType.right(sDstName.length()))
+  else if (fixUp==2)
   { // case "unsigned int i" <-> "unsigned int"
-    dstA->type+=sDstName;
+    dstA->type+=" "+dstA->name;
     dstA->name="";
     dstA->canType=""; // invalidate cached type value
   }
@@ -3752,10 +4306,18 @@ static bool matchArgument2(
   {
     srcA->canType = extractCanonicalArgType(srcScope,srcFileScope,srcA);
   }
+  else
+  {
+    g_canonicalTypeCache.argumentHit();
+  }
   if (dstA->canType.isEmpty())
   {
     dstA->canType = extractCanonicalArgType(dstScope,dstFileScope,dstA);
   }
+  else
+  {
+    g_canonicalTypeCache.argumentHit();
+  }
 
   if (srcA->canType==dstA->canType)
   {
@@ -3795,22 +4357,42 @@ bool matchArguments2(const Definition *srcScope,const FileDef *srcFileScope,cons
     }
   }
 
+  // a list always matches itself, unless its types may resolve differently
+  // in the two scopes
+  if (srcAl==dstAl &&
+      ((srcScope==dstScope && srcFileScope==dstFileScope) ||
+       (srcAl->isPooled() && srcAl->isScopeIndependent())
+      )
+     )
+  {
+    MATCH
+    return TRUE;
+  }
+
   // handle special case with void argument
+  // (pooled lists are shared and cannot be changed, callers that want to
+  // keep the fix-ups use argumentListForMatching())
   if ( srcAl->count()==0 && dstAl->count()==1 && 
       dstAl->getFirst()->type=="void" )
   { // special case for finding match between func() and func(void)
-    Argument *a=new Argument;
-    a->type = "void";
-    const_cast<ArgumentList*>(srcAl)->append(a);
+    if (!srcAl->isPooled())
+    {
+      Argument *a=new Argument;
+      a->type = "void";
+      const_cast<ArgumentList*>(srcAl)->append(a);
+    }
     MATCH
     return TRUE;
   }
   if ( dstAl->count()==0 && srcAl->count()==1 &&
       srcAl->getFirst()->type=="void" )
   { // special case for finding match between func(void) and func()
-    Argument *a=new Argument;
-    a->type = "void";
-    const_cast<ArgumentList*>(dstAl)->append(a);
+    if (!dstAl->isPooled())
+    {
+      Argument *a=new Argument;
+      a->type = "void";
+      const_cast<ArgumentList*>(dstAl)->append(a);
+    }
     MATCH
     return TRUE;
   }
@@ -3847,6 +4429,22 @@ bool matchArguments2(const Definition *srcScope,const FileDef *srcFileScope,cons
   Argument *srcA,*dstA;
   for (;(srcA=srcAli.current()) && (dstA=dstAli.current());++srcAli,++dstAli)
   { 
+    // pooled arguments are shared, so they are only given to matchArgument2
+    // if it does not fix up their name and caches a canonical type that is
+    // the same in every scope, otherwise a copy is matched
+    Argument srcCopy,dstCopy;
+    if (srcAl->isPooled() || dstAl->isPooled())
+    {
+      int fixUp = argumentNameFixUp(srcA,dstA);
+      if (srcAl->isPooled() && (fixUp==1 || !srcAl->isScopeIndependent()))
+      {
+        srcCopy=*srcA; srcA=&srcCopy;
+      }
+      if (dstAl->isPooled() && (fixUp==2 || !dstAl->isScopeIndependent()))
+      {
+        dstCopy=*dstA; dstA=&dstCopy;
+      }
+    }
     if (!matchArgument2(srcScope,srcFileScope,srcA,
           dstScope,dstFileScope,dstA)
        )
@@ -3861,6 +4459,36 @@ bool matchArguments2(const Definition *srcScope,const FileDef *srcFileScope,cons
 
 
 
+/*! Returns TRUE if matchArguments2() may change \a al to make it match
+ *  \a other, with \a al either as the source or as the destination list.
+ */
+static bool argumentListNeedsFixUp(const ArgumentList *al,const ArgumentList *other)
+{
+  if (al==0 || other==0) return FALSE;
+  if (al->count()==0)
+  {
+    return other->count()==1 && other->getFirst()->type=="void";
+  }
+  if (al->count()!=other->count()) return FALSE;
+  ArgumentListIterator ali(*al),oli(*other);
+  const Argument *a,*o;
+  for (;(a=ali.current()) && (o=oli.current());++ali,++oli)
+  {
+    if (argumentNameFixUp(a,o)==1 || argumentNameFixUp(o,a)==2) return TRUE;
+  }
+  return FALSE;
+}
+
+const ArgumentList *argumentListForMatching(MemberDef *md,const ArgumentList *other)
+{
+  const ArgumentList *al = md->argumentList();
+  if (al && al->isPooled() && argumentListNeedsFixUp(al,other))
+  {
+    return md->writableArgumentList();
+  }
+  return al;
+}
+
 // merges the initializer of two argument lists
 // pre:  the types of the arguments in the list should match.
 void mergeArguments(ArgumentList *srcAl,ArgumentList *dstAl,bool forceNameOverwrite)
@@ -4041,6 +4669,121 @@ static void findMembersWithSpecificName(MemberName *mn,
   }
 }
 
+/** Result of a getDefs() or resolveRef() call. */
+struct ResolveCacheElem
+{
+  ResolveCacheElem() : found(FALSE), context(0), md(0), cd(0), fd(0), nd(0), gd(0) {}
+  bool found;
+  const Definition   *context;
+  const MemberDef    *md;
+  const ClassDef     *cd;
+  const FileDef      *fd;
+  const NamespaceDef *nd;
+  const GroupDef     *gd;
+};
+
+/** Helper class storing the results of getDefs() and resolveRef().
+ *
+ *  The same references are resolved for every page they appear on and
+ *  for every output format. Once the symbols and their relations are
+ *  complete the result only depends on the arguments of the call, so
+ *  the found definitions can be stored with the arguments as the key.
+ *  The results do not depend on the output format, since only the
+ *  definitions are stored and not their file names or anchors.
+ */
+class ResolveCache
+{
+  public:
+    ResolveCache() : m_cache(65536,16411), m_enabled(FALSE), m_hits(0), m_misses(0)
+    {
+      m_cache.setAutoDelete(TRUE);
+    }
+    bool isEnabled() const { return m_enabled; }
+    void setEnabled(bool enable)
+    {
+      QMutexLocker lock(&m_mutex);
+      m_enabled = enable;
+      m_cache.clear();
+    }
+    bool find(const QCString &key,ResolveCacheElem &result)
+    {
+      QMutexLocker lock(&m_mutex);
+      ResolveCacheElem *e = m_cache.find(key);
+      if (e)
+      {
+        m_hits++;
+        result = *e;
+        return TRUE;
+      }
+      m_misses++;
+      return FALSE;
+    }
+    void insert(const QCString &key,const ResolveCacheElem &result)
+    {
+      QMutexLocker lock(&m_mutex);
+      if (m_enabled && m_cache.find(key,FALSE)==0)
+      {
+        m_cache.insert(key,new ResolveCacheElem(result));
+      }
+    }
+    uint hits() const { return m_hits; }
+    uint misses() const { return m_misses; }
+
+    /** Returns the key for a call with the given arguments. A \c 0 string
+     *  and an empty string give a different key.
+     */
+    static QCString key(char kind,const char *scope,const char *name,const char *args,
+                        const char *tagFile,const FileDef *currentFile,int flags)
+    {
+      const int maxAddrSize = 24;
+      char addr[maxAddrSize];
+      qsnprintf(addr,maxAddrSize,"%c%x:%p:",kind,flags,(const void*)currentFile);
+      QCString result = addr;
+      if (scope) { result+='.'; result+=scope; }
+      result+='\t';
+      result+=name;
+      result+='\t';
+      if (args) { result+='('; result+=args; }
+      result+='\t';
+      if (tagFile) { result+='@'; result+=tagFile; }
+      return result;
+    }
+
+  private:
+    QCache<ResolveCacheElem> m_cache;
+    QMutex m_mutex;
+    bool m_enabled;
+    uint m_hits;
+    uint m_misses;
+};
+
+static ResolveCache g_resolveCache;
+
+void setResolveCacheEnabled(bool enable)
+{
+  g_resolveCache.setEnabled(enable);
+}
+
+void getResolveCacheStats(uint &hits,uint &misses)
+{
+  hits   = g_resolveCache.hits();
+  misses = g_resolveCache.misses();
+}
+
+static bool getDefsNoCache(const QCString &scName,
+             const QCString &mbName, 
+             const char *args,
+             const MemberDef *&md, 
+             const ClassDef *&cd, 
+             const FileDef *&fd, 
+             const NamespaceDef *&nd, 
+             const GroupDef *&gd,
+             bool forceEmptyScope,
+             const FileDef *currentFile,
+             bool checkCV,
+             const char *forceTagFile
+            );
+
 /*!
  * Searches for a member definition given its name 'memberName' as a string.
  * memberName may also include a (partial) scope to indicate the scope
@@ -4076,6 +4819,38 @@ bool getDefs(const QCString &scName,
              bool checkCV,
              const char *forceTagFile
             )
+{
+  if (!g_resolveCache.isEnabled())
+  {
+    return getDefsNoCache(scName,mbName,args,md,cd,fd,nd,gd,
+                          forceEmptyScope,currentFile,checkCV,forceTagFile);
+  }
+  QCString key = ResolveCache::key('D',scName,mbName,args,forceTagFile,currentFile,
+                                   (forceEmptyScope?1:0)|(checkCV?2:0));
+  ResolveCacheElem result;
+  if (!g_resolveCache.find(key,result))
+  {
+    result.found = getDefsNoCache(scName,mbName,args,result.md,result.cd,result.fd,result.nd,result.gd,
+                                  forceEmptyScope,currentFile,checkCV,forceTagFile);
+    g_resolveCache.insert(key,result);
+  }
+  md=result.md; cd=result.cd; fd=result.fd; nd=result.nd; gd=result.gd;
+  return result.found;
+}
+
+static bool getDefsNoCache(const QCString &scName,
+             const QCString &mbName, 
+             const char *args,
+             const MemberDef *&md, 
+             const ClassDef *&cd, 
+             const FileDef *&fd, 
+             const NamespaceDef *&nd, 
+             const GroupDef *&gd,
+             bool forceEmptyScope,
+             const FileDef *currentFile,
+             bool checkCV,
+             const char *forceTagFile
+            )
 {
   fd=0, md=0, cd=0, nd=0, gd=0;
   if (mbName.isEmpty()) return FALSE; /* empty name => nothing to link */
@@ -4164,7 +4939,7 @@ bool getDefs(const QCString &scName,
         {
           if (!mmd->isStrongEnumValue())
           {
-            ArgumentList *mmdAl = mmd->argumentList();
+            const ArgumentList *mmdAl = argumentListForMatching(mmd,argList);
             bool match=args==0 || 
               matchArguments2(mmd->getOuterScope(),mmd->getFileDef(),mmdAl,
                   fcd,fcd->getFileDef(),argList,
@@ -4291,7 +5066,7 @@ bool getDefs(const QCString &scName,
 
       if (!args) break;
 
-      ArgumentList *mmdAl = mmd->argumentList();
+      const ArgumentList *mmdAl = argumentListForMatching(mmd,argList);
       if (matchArguments2(mmd->getOuterScope(),mmd->getFileDef(),mmdAl,
             Doxygen::globalScope,mmd->getFileDef(),argList,
             checkCV
@@ -4610,6 +5385,16 @@ static bool isLowerCase(QCString &s)
   return TRUE; 
 }
 
+static bool resolveRefNoCache(const char *scName,
+    const char *name,
+    bool inSeeBlock,
+    const Definition **resContext,
+    const MemberDef  **resMember,
+    bool lookForSpecialization,
+    const FileDef *currentFile,
+    bool checkScope
+    );
+
 /*! Returns an object to reference to given its name and context 
  *  @post return value TRUE implies *resContext!=0 or *resMember!=0
  */
@@ -4622,6 +5407,35 @@ bool resolveRef(/* in */  const char *scName,
     const FileDef *currentFile,
     bool checkScope
     )
+{
+  if (!g_resolveCache.isEnabled())
+  {
+    return resolveRefNoCache(scName,name,inSeeBlock,resContext,resMember,
+                             lookForSpecialization,currentFile,checkScope);
+  }
+  QCString key = ResolveCache::key('R',scName,name,0,0,currentFile,
+                                   (inSeeBlock?1:0)|(lookForSpecialization?2:0)|(checkScope?4:0));
+  ResolveCacheElem result;
+  if (!g_resolveCache.find(key,result))
+  {
+    result.found = resolveRefNoCache(scName,name,inSeeBlock,&result.context,&result.md,
+                                     lookForSpecialization,currentFile,checkScope);
+    g_resolveCache.insert(key,result);
+  }
+  *resContext=result.context;
+  *resMember=result.md;
+  return result.found;
+}
+
+static bool resolveRefNoCache(const char *scName,
+    const char *name,
+    bool inSeeBlock,
+    const Definition **resContext,
+    const MemberDef  **resMember,
+    bool lookForSpecialization,
+    const FileDef *currentFile,
+    bool checkScope
+    )
 {
   //printf("resolveRef(scope=%s,name=%s,inSeeBlock=%d)\n",scName,name,inSeeBlock);
   QCString tsName = name;
@@ -5096,11 +5910,13 @@ struct FindFileCacheElem
 };
 
 static QCache<FindFileCacheElem> g_findFileDefCache(5000);
+static QMutex g_findFileDefMutex; // the cache is also used while parsing on several threads
 
 FileDef *findFileDef(const FileNameDict *fnDict,const char *n,bool &ambig)
 {
   ambig=FALSE;
   if (n==0) return 0;
+  QMutexLocker locker(&g_findFileDefMutex);
 
   const int maxAddrSize = 20;
   char addr[maxAddrSize];
@@ -5226,13 +6042,15 @@ QCString substitute(const QCString &s,const QCString &src,const QCString &dst)
 {
   if (s.isEmpty() || src.isEmpty()) return s;
   const char *p, *q;
+  const char *first = strstr(s.data(),src);
+  if (first==0) return s; // nothing to substitute, share the string
   int srcLen = src.length();
   int dstLen = dst.length();
   int resLen;
   if (srcLen!=dstLen)
   {
     int count;
-    for (count=0, p=s.data(); (q=strstr(p,src))!=0; p=q+srcLen) count++;
+    for (count=0, p=first; (q=strstr(p,src))!=0; p=q+srcLen) count++;
     resLen = s.length()+count*(dstLen-srcLen);
   }
   else // result has same size as s
@@ -5263,6 +6081,7 @@ QCString substitute(const QCString &s,const QCString &src,const QCString &dst)
 QCString substitute(const QCString &s,const QCString &src,const QCString &dst,int skip_seq)
 {
   if (s.isEmpty() || src.isEmpty()) return s;
+  if (strstr(s.data(),src)==0) return s; // nothing to substitute, share the string
   const char *p, *q;
   int srcLen = src.length();
   int dstLen = dst.length();
@@ -5318,6 +6137,7 @@ QCString substitute(const QCString &s,const QCString &src,const QCString &dst,in
 /// substitute all occurrences of \a srcChar in \a s by \a dstChar
 QCString substitute(const QCString &s,char srcChar,char dstChar)
 {
+  if (s.find(srcChar)==-1) return s; // nothing to substitute, share the string
   int l=s.length();
   QCString result(l+1);
   char *q=result.rawData();
@@ -5457,7 +6277,7 @@ QCString escapeCharsInString(const char *name,bool allowDots,bool allowUnderscor
 {
   static bool caseSenseNames = Config_getBool(CASE_SENSE_NAMES);
   static bool allowUnicodeNames = Config_getBool(ALLOW_UNICODE_NAMES);
-  static GrowBuf growBuf;
+  static thread_local GrowBuf growBuf;
   growBuf.clear();
   if (name==0) return "";
   char c;
@@ -5973,7 +6793,7 @@ QCString stripScope(const char *name)
 QCString convertToId(const char *s)
 {
   static const char hex[] = "0123456789ABCDEF";
-  static GrowBuf growBuf;
+  static thread_local GrowBuf growBuf;
   growBuf.clear();
   if (s==0) return "";
   const char *p=s;
@@ -6004,7 +6824,7 @@ QCString convertToId(const char *s)
 /*! Converts a string to an XML-encoded string */
 QCString convertToXML(const char *s, bool keepEntities)
 {
-  static GrowBuf growBuf;
+  static thread_local GrowBuf growBuf;
   growBuf.clear();
   if (s==0) return "";
   const char *p=s;
@@ -6056,7 +6876,7 @@ QCString convertToXML(const char *s, bool keepEntities)
 /*! Converts a string to an DocBook-encoded string */
 QCString convertToDocBook(const char *s)
 {
-  static GrowBuf growBuf;
+  static thread_local GrowBuf growBuf;
   growBuf.clear();
   if (s==0) return "";
   const unsigned char *q;
@@ -6116,10 +6936,14 @@ QCString convertToDocBook(const char *s)
 /*! Converts a string to a HTML-encoded string */
 QCString convertToHtml(const char *s,bool keepEntities)
 {
-  static GrowBuf growBuf;
+  static bool textDirNone = qstrcmp(Config_getEnum(OUTPUT_TEXT_DIRECTION),"None")==0;
+  static thread_local GrowBuf growBuf;
   growBuf.clear();
   if (s==0) return "";
-  growBuf.addStr(getHtmlDirEmbedingChar(getTextDirByConfig(s)));
+  if (!textDirNone) // avoid converting s to a QString just to find out its direction
+  {
+    growBuf.addStr(getHtmlDirEmbedingChar(getTextDirByConfig(s)));
+  }
   const char *p=s;
   char c;
   while ((c=*p++))
@@ -6164,7 +6988,7 @@ QCString convertToHtml(const char *s,bool keepEntities)
 /*! Converts a string to an Asciidoc-encoded string */
 QCString convertToAsciidoc(const char *s)
 {
-  static GrowBuf growBuf;
+  static thread_local GrowBuf growBuf;
   if (s==0) return "";
   growBuf.clear();
   int cnt;
@@ -6208,7 +7032,7 @@ QCString convertToAsciidoc(const char *s)
 
 QCString convertToJSString(const char *s, bool applyTextDir)
 {
-  static GrowBuf growBuf;
+  static thread_local GrowBuf growBuf;
   growBuf.clear();
   if (s==0) return "";
   if (applyTextDir)
@@ -6244,7 +7068,7 @@ QCString convertCharEntitiesToUTF8(const QCString &s)
   static QRegExp entityPat("&[a-zA-Z]+[0-9]*;");
 
   if (s.length()==0) return result;
-  static GrowBuf growBuf;
+  static thread_local GrowBuf growBuf;
   growBuf.clear();
   int p,i=0,l;
   while ((p=entityPat.match(s,i,&l))!=-1)
@@ -7310,6 +8134,32 @@ QCString stripPath(const char *s)
   return result;
 }
 
+/*! Returns the invisible name of the \a count-th anonymous scope found in
+ *  file \a fileName. The name is an '@' followed by digits, like the
+ *  names used before, but it does not depend on the order in which the
+ *  files are parsed.
+ */
+QCString generateAnonymousAnchor(const QCString &fileName,int count)
+{
+  QCString fn = stripFromPath(fileName)+":"+QCString().setNum(count);
+  const int sig_size=16;
+  uchar md5_sig[sig_size];
+  MD5Buffer((const unsigned char *)fn.data(),fn.length(),md5_sig);
+  char result[sig_size*3+2];
+  char *p = result;
+  *p++='@';
+  for (int i=0;i<sig_size;i++)
+  {
+    static const char oct[]="01234567";
+    uchar byte = md5_sig[i];
+    *p++=oct[(byte>>6)&7];
+    *p++=oct[(byte>>3)&7];
+    *p++=oct[(byte>>0)&7];
+  }
+  *p='\0';
+  return result;
+}
+
 /** returns \c TRUE iff string \a s contains word \a w */
 bool containsWord(const QCString &s,const QCString &word)
 {
@@ -7770,7 +8620,7 @@ QCString parseCommentAsText(const Definition *scope,const MemberDef *md,
 
 //--------------------------------------------------------------------------------------
 
-static QDict<void> aliasesProcessed;
+static thread_local QDict<void> aliasesProcessed; // aliases being expanded by this thread
 
 static QCString expandAliasRec(const QCString s,bool allowRecursion=FALSE);
 
@@ -8155,42 +9005,45 @@ static int transcodeCharacterBuffer(const char *fileName,BufStr &srcBuf,int size
   return newSize;
 }
 
-//! read a file name \a fileName and optionally filter and transcode it
-bool readInputFile(const char *fileName,BufStr &inBuf,bool filter,bool isSourceCode)
+/*! Reads the file \a fileName into \a inBuf, passing it through the
+ *  command \a filterName first if that is not empty, and transcodes the
+ *  result from \a inputEncoding to UTF-8.
+ *  Unlike readInputFile() this function does not consult the configuration,
+ *  so it can also be used from a worker thread.
+ */
+bool loadInputFile(const char *fileName,BufStr &inBuf,
+                   const char *filterName,const char *inputEncoding)
 {
-  // try to open file
   int size=0;
-  //uint oldPos = dest.curPos();
-  //printf(".......oldPos=%d\n",oldPos);
-
-  QFileInfo fi(fileName);
-  if (!fi.exists()) return FALSE;
-  QCString filterName = getFileFilter(fileName,isSourceCode);
-  if (filterName.isEmpty() || !filter)
+  if (filterName==0 || filterName[0]==0)
   {
-    QFile f(fileName);
-    if (!f.open(IO_ReadOnly))
+    FILE *f=portable_fopen(fileName,"rb");
+    if (!f)
     {
       err("could not open file %s\n",fileName);
       return FALSE;
     }
-    size=fi.size();
+    portable_fseek(f,0,SEEK_END);
+    size=(int)portable_ftell(f);
+    portable_fseek(f,0,SEEK_SET);
     // read the file
     inBuf.skip(size);
-    if (f.readBlock(inBuf.data()/*+oldPos*/,size)!=size)
+    if (size<0 || (int)fread(inBuf.data(),1,size,f)!=size)
     {
       err("problems while reading file %s\n",fileName);
+      fclose(f);
       return FALSE;
     }
+    fclose(f);
   }
   else
   {
-    QCString cmd=filterName+" \""+fileName+"\"";
+    QCString cmd=QCString(filterName)+" \""+fileName+"\"";
     Debug::print(Debug::ExtCmd,0,"Executing popen(`%s`)\n",qPrint(cmd));
     FILE *f=portable_popen(cmd,"r");
     if (!f)
     {
-      err("could not execute filter %s\n",filterName.data());
+      err("could not execute filter %s\n",filterName);
       return FALSE;
     }
     const int bufSize=1024;
@@ -8229,7 +9082,7 @@ bool readInputFile(const char *fileName,BufStr &inBuf,bool filter,bool isSourceC
   {
     // do character transcoding if needed.
     transcodeCharacterBuffer(fileName,inBuf,inBuf.curPos(),
-        Config_getString(INPUT_ENCODING),"UTF-8");
+        inputEncoding,"UTF-8");
   }
 
   //inBuf.addChar('\n'); /* to prevent problems under Windows ? */
@@ -8247,6 +9100,66 @@ bool readInputFile(const char *fileName,BufStr &inBuf,bool filter,bool isSourceC
   return TRUE;
 }
 
+//! read a file name \a fileName and optionally filter and transcode it
+bool readInputFile(const char *fileName,BufStr &inBuf,bool filter,bool isSourceCode)
+{
+  QFileInfo fi(fileName);
+  if (!fi.exists()) return FALSE;
+  QCString filterName;
+  if (filter)
+  {
+    filterName = getFileFilter(fileName,isSourceCode);
+  }
+  return loadInputFile(fileName,inBuf,filterName,Config_getString(INPUT_ENCODING));
+}
+
+/*! Maps the file \a fileName into memory if its contents can be used
+ *  without running the filter \a filterName or transcoding it from
+ *  \a inputEncoding. Returns FALSE if the file should be read with
+ *  readInputFile() instead.
+ */
+bool MappedInputFile::map(const char *fileName,const char *filterName,const char *inputEncoding)
+{
+  unmap();
+  if (filterName && filterName[0]) return FALSE;
+  if (inputEncoding && qstricmp(inputEncoding,"UTF-8")!=0) return FALSE;
+  m_map = portable_mapFile(fileName,m_mapSize);
+  if (m_map==0) return FALSE;
+  const char *p = m_map;
+  uint size = m_mapSize;
+  if (size>=2 &&
+      (((uchar)p[0]==0xFF && (uchar)p[1]==0xFE) || // Little endian BOM
+       ((uchar)p[0]==0xFE && (uchar)p[1]==0xFF)    // big endian BOM
+      )
+     ) // UCS-2 encoded file, needs transcoding
+  {
+    unmap();
+    return FALSE;
+  }
+  if (size>=3 && (uchar)p[0]==0xEF && (uchar)p[1]==0xBB && (uchar)p[2]==0xBF)
+  {
+    p+=3; size-=3; // skip UTF-8 BOM
+  }
+  // CR's need to be translated and NUL's confuse the parser, see filterCRLF()
+  if (memchr(p,'\r',size) || memchr(p,'\0',size))
+  {
+    unmap();
+    return FALSE;
+  }
+  m_data = p;
+  m_size = size;
+  return TRUE;
+}
+
+void MappedInputFile::unmap()
+{
+  portable_unmapFile(m_map,m_mapSize);
+  m_map=0;
+  m_mapSize=0;
+  m_data=0;
+  m_size=0;
+}
+
 // Replace %word by word in title
 QCString filterTitle(const QCString &title)
 {
@@ -8267,44 +9180,34 @@ QCString filterTitle(const QCString &title)
 // returns TRUE if the name of the file represented by 'fi' matches
 // one of the file patterns in the 'patList' list.
 
-bool patternMatch(const QFileInfo &fi,const QStrList *patList)
+/** Returns TRUE if patterns like FILE_PATTERNS and EXCLUDE_PATTERNS should
+ *  be matched case sensitively against file names.
+ */
+bool filePatternsCaseSensitive()
 {
-  static bool caseSenseNames = Config_getBool(CASE_SENSE_NAMES);
-  bool found = FALSE;
-
   // For Windows/Mac, always do the case insensitive match
 #if defined(_WIN32) || defined(__MACOSX__) || defined(__CYGWIN__)
-  caseSenseNames = FALSE;
+  return FALSE;
+#else
+  static bool caseSenseNames = Config_getBool(CASE_SENSE_NAMES);
+  return caseSenseNames;
 #endif
+}
 
-  if (patList)
-  {
-    QStrListIterator it(*patList);
-    QCString pattern;
-
-    QCString fn = fi.fileName().data();
-    QCString fp = fi.filePath().data();
-    QCString afp= fi.absFilePath().data();
-
-    for (it.toFirst();(pattern=it.current());++it)
-    {
-      if (!pattern.isEmpty())
-      {
-        int i=pattern.find('=');
-        if (i!=-1) pattern=pattern.left(i); // strip of the extension specific filter name
-
-        QRegExp re(pattern,caseSenseNames,TRUE);
+/** Returns TRUE if the name, path or absolute path of file \a fi matches
+ *  one of the patterns of \a matcher.
+ */
+bool patternMatch(const QFileInfo &fi,const PatternMatcher *matcher)
+{
+  if (matcher==0 || matcher->isEmpty()) return FALSE;
 
-        found = re.match(fn)!=-1 ||
-                re.match(fp)!=-1 ||
-                re.match(afp)!=-1;
-        if (found) break;
-        //printf("Matching '%s' against pattern '%s' found=%d\n",
-        //    fi->fileName().data(),pattern.data(),found);
-      }
-    }
-  }
-  return found;
+  QCString fn = fi.fileName().data();
+  if (matcher->match(fn)) return TRUE;
+  QCString fp = fi.filePath().data();
+  if (fp!=fn && matcher->match(fp)) return TRUE;
+  QCString afp= fi.absFilePath().data();
+  if (afp!=fp && matcher->match(afp)) return TRUE;
+  return FALSE;
 }
 
 #if 0 // move to HtmlGenerator::writeSummaryLink
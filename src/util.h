@@ -59,6 +59,7 @@ class QFileInfo;
 class QStrList;
 class FTextStream;
 class QFile;
+class PatternMatcher;
 
 //--------------------------------------------------------------------
 
@@ -117,6 +118,34 @@ class LetterToIndexMap : public SIntDict<T>
 
 //--------------------------------------------------------------------
 
+/** @brief Read-only memory mapping of an input file.
+ *
+ *  The mapping is only made if the contents can be passed to the
+ *  preprocessor as is, i.e. if no input filter is used, the file is
+ *  UTF-8 encoded and does not contain CR or NUL characters.
+ *  Otherwise the file has to be read with readInputFile().
+ */
+class MappedInputFile
+{
+  public:
+    MappedInputFile() : m_map(0), m_mapSize(0), m_data(0), m_size(0) {}
+   ~MappedInputFile() { unmap(); }
+    bool map(const char *fileName,const char *filterName,const char *inputEncoding);
+    void unmap();
+    bool isMapped() const { return m_data!=0; }
+    const char *data() const { return m_data; }
+    uint size() const { return m_size; }
+  private:
+    MappedInputFile(const MappedInputFile &);
+    MappedInputFile &operator=(const MappedInputFile &);
+    const char *m_map;
+    uint m_mapSize;
+    const char *m_data; // start of the contents, after a possible BOM
+    uint m_size;
+};
+
+//--------------------------------------------------------------------
+
 QCString langToString(SrcLangExt lang);
 QCString getLanguageSpecificSeparator(SrcLangExt lang,bool classScope=FALSE);
 QCString replaceScopeSeparator(QCString str);
@@ -134,6 +163,14 @@ void linkifyText(const TextGeneratorIntf &ol,
                  int indentLevel=0
                 );
 
+/** Collects the names of all symbols that linkifyText() could link to, so
+ *  words that can never resolve skip the lookups. Must be called when no
+ *  more symbols are added.
+ */
+void initLinkifyFilter();
+
+void getLinkifyFilterStats(uint &skipped,uint &lookedUp);
+
 void setAnchors(MemberList *ml);
 
 QCString fileToString(const char *name,bool filter=FALSE,bool isSourceCode=FALSE);
@@ -173,6 +210,13 @@ bool resolveLink(/* in */  const char *scName,
                  /* out */ QCString &resAnchor
                 );
 
+/** Enables or disables storing the results of getDefs() and resolveRef().
+ *  Must only be enabled when no more symbols or relations are added.
+ */
+void setResolveCacheEnabled(bool enable);
+
+void getResolveCacheStats(uint &hits,uint &misses);
+
 //bool generateRef(OutputDocInterface &od,const char *,
 //                        const char *,bool inSeeBlock,const char * =0);
 
@@ -191,6 +235,20 @@ bool matchArguments2(const Definition *srcScope,const FileDef *srcFileScope,cons
                      bool checkCV
                     );
 
+/*! Returns the argument list of \a md for matching it against \a other
+ *  with matchArguments2(). If the match would fix up a list that \a md
+ *  shares with other members, \a md first gets a copy of its own, so the
+ *  fix-up is kept.
+ */
+const ArgumentList *argumentListForMatching(MemberDef *md,const ArgumentList *other);
+
+/** Drops the canonical types cached by matchArguments2().
+ *  Needs to be called when the result of a type lookup may have changed.
+ */
+void invalidateCanonicalTypeCache();
+
+void getCanonicalTypeCacheStats(uint &argHits,uint &typeHits,uint &typeMisses);
+
 void mergeArguments(ArgumentList *,ArgumentList *,bool forceNameOverwrite=FALSE);
 
 QCString substituteClassNames(const QCString &s);
@@ -375,6 +433,14 @@ int isAccessibleFrom(const Definition *scope,const FileDef *fileScope,const Defi
 int isAccessibleFromWithExpScope(const Definition *scope,const FileDef *fileScope,const Definition *item,
                      const QCString &explicitScopePart);
 
+/** Drops the cached results of isAccessibleFrom() and isAccessibleFromWithExpScope().
+ *  Needs to be called when scopes, nested compounds, typedefs, using relations or
+ *  inheritance relations change, since the walks look all of them up.
+ */
+void invalidateAccessCache();
+
+void getAccessCacheStats(uint &avoided,uint &computed);
+
 int computeQualifiedIndex(const QCString &name);
 
 void addDirPrefix(QCString &fileName);
@@ -385,6 +451,8 @@ void createSubDirs(QDir &d);
 
 QCString stripPath(const char *s);
 
+QCString generateAnonymousAnchor(const QCString &fileName,int count);
+
 bool containsWord(const QCString &s,const QCString &word);
 
 bool findAndRemoveWord(QCString &s,const QCString &word);
@@ -431,9 +499,12 @@ void stackTrace();
 
 bool readInputFile(const char *fileName,BufStr &inBuf,
                    bool filter=TRUE,bool isSourceCode=FALSE);
+bool loadInputFile(const char *fileName,BufStr &inBuf,
+                   const char *filterName,const char *inputEncoding);
 QCString filterTitle(const QCString &title);
 
-bool patternMatch(const QFileInfo &fi,const QStrList *patList);
+bool filePatternsCaseSensitive();
+bool patternMatch(const QFileInfo &fi,const PatternMatcher *matcher);
 
 QCString externalLinkTarget();
 QCString externalRef(const QCString &relPath,const QCString &ref,bool href);
@@ -917,7 +917,7 @@ MemberDef* VhdlDocGen::findFunction(const QList<Argument> &ql,
       QCString mname=mdef->name();
       if ((VhdlDocGen::isProcedure(mdef) || VhdlDocGen::isVhdlFunction(mdef)) && (compareString(funcname,mname)==0))
       {
-        ArgumentList *alp = mdef->argumentList();
+        const ArgumentList *alp = mdef->argumentList();
 
         //  ArgumentList* arg2=mdef->getArgumentList();
         if (alp==0) break;
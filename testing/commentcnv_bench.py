@@ -0,0 +1,86 @@
+#!/usr/bin/python
+
+# Compares the output of the comment converter (doxygen -d commentcnv) of two
+# doxygen executables over the sources of the regression tests, and reports
+# the time each executable needs to process these sources.
+
+from __future__ import print_function
+import argparse, glob, os, shutil, subprocess, sys, time
+
+def write_config(args,dir_name,input_dir):
+	with open(dir_name+'/Doxyfile','w') as f:
+		print('INPUT            = %s' % input_dir, file=f)
+		print('FILE_PATTERNS    = *', file=f)
+		print('RECURSIVE        = YES', file=f)
+		print('EXCLUDE_PATTERNS = */Doxyfile', file=f)
+		print('OUTPUT_DIRECTORY = %s/out' % dir_name, file=f)
+		print('EXTRACT_ALL      = YES', file=f)
+		print('QUIET            = YES', file=f)
+		print('WARNINGS         = NO', file=f)
+		print('GENERATE_HTML    = NO', file=f)
+		print('GENERATE_LATEX   = NO', file=f)
+
+def prepare_input(args,dir_name):
+	# copy the sources of the tests scale times, to get a measurable amount of input
+	input_dir = dir_name+'/input'
+	files = glob.glob(args.inputdir+'/[0-9][0-9][0-9]_*.*')
+	for i in range(args.scale):
+		copy_dir = '%s/copy%d' % (input_dir,i)
+		os.makedirs(copy_dir)
+		for f in files:
+			shutil.copy(f,copy_dir)
+	return (input_dir,len(files)*args.scale)
+
+def run(doxygen,dir_name,debug):
+	cmd = [doxygen]
+	if debug:
+		cmd += ['-d','commentcnv']
+	cmd += [dir_name+'/Doxyfile']
+	start = time.time()
+	out = subprocess.check_output(cmd)
+	return (time.time()-start,out)
+
+def best_time(args,doxygen,dir_name):
+	return min([run(doxygen,dir_name,False)[0] for i in range(args.repeat)])
+
+def main():
+	parser = argparse.ArgumentParser(description='benchmark the comment converter')
+	parser.add_argument('--doxygen',nargs='?',default='doxygen',help=
+		'path/name of the doxygen executable to test')
+	parser.add_argument('--reference',nargs='?',help=
+		'path/name of the doxygen executable to compare against')
+	parser.add_argument('--inputdir',nargs='?',default='.',help=
+		'input directory containing the tests')
+	parser.add_argument('--outputdir',nargs='?',default='.',help=
+		'output directory to write the temporary files to')
+	parser.add_argument('--scale',type=int,default=10,help=
+		'number of copies of the test sources to process')
+	parser.add_argument('--repeat',type=int,default=3,help=
+		'number of runs per executable, the fastest run is reported')
+	args = parser.parse_args()
+
+	dir_name = args.outputdir+'/commentcnv_bench'
+	shutil.rmtree(dir_name,ignore_errors=True)
+	os.makedirs(dir_name)
+	(input_dir,num_files) = prepare_input(args,dir_name)
+	write_config(args,dir_name,input_dir)
+
+	res = 0
+	if args.reference:
+		got = run(args.doxygen,dir_name,True)[1]
+		expected = run(args.reference,dir_name,True)[1]
+		if got!=expected:
+			print('Output of the comment converter differs from the reference')
+			res = 1
+		else:
+			print('Output of the comment converter is identical for %d files (%d bytes)' %
+					(num_files,len(got)))
+	print('%s: %.3f sec' % (args.doxygen,best_time(args,args.doxygen,dir_name)))
+	if args.reference:
+		print('%s: %.3f sec' % (args.reference,best_time(args,args.reference,dir_name)))
+
+	shutil.rmtree(dir_name,ignore_errors=True)
+	sys.exit(res)
+
+if __name__ == '__main__':
+	main()